@@ -0,0 +1,328 @@
+/**************************************************************************************
+// The following class renders a screen area from a list of layers a band of rows at a
+// time, see Compositor.h. The band sprite has a viewport set for each band so layers
+// are drawn in area coordinates and clipped to the band rows by the sprite functions.
+***************************************************************************************/
+
+/***************************************************************************************
+** Function name:           TFT_eCompositor
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eCompositor::TFT_eCompositor(TFT_eSPI *tft) : _band(tft)
+{
+  _tft = tft;
+
+  _layer     = nullptr;
+  _layers    = 0;
+  _maxLayers = 0;
+
+  _width    = 0;
+  _height   = 0;
+  _bandRows = 0;
+  _bg       = TFT_BLACK;
+}
+
+
+/***************************************************************************************
+** Function name:           ~TFT_eCompositor
+** Description:             Class destructor
+***************************************************************************************/
+TFT_eCompositor::~TFT_eCompositor(void)
+{
+  end();
+}
+
+
+/***************************************************************************************
+** Function name:           begin
+** Description:             Create the band sprite and the layer list
+***************************************************************************************/
+bool TFT_eCompositor::begin(int16_t w, int16_t h, uint8_t bandRows, uint8_t maxLayers)
+{
+  end();
+
+  if (w < 1 || h < 1 || bandRows < 1 || maxLayers < 1) return false;
+  if (bandRows > h) bandRows = h;
+
+  // The band is small and rewritten for every band, so keep it out of PSRAM
+  _band.setAttribute(PSRAM_ENABLE, false);
+  _band.setColorDepth(16);
+  if (_band.createSprite(w, bandRows) == nullptr) return false;
+
+  // Wrapping would use the band size, string layers are placed by x, y only
+  _band.setTextWrap(false, false);
+
+  _layer = (layer_t *)malloc(maxLayers * sizeof(layer_t));
+  if (_layer == nullptr) { _band.deleteSprite(); return false; }
+
+  _maxLayers = maxLayers;
+  _width     = w;
+  _height    = h;
+  _bandRows  = bandRows;
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           end
+** Description:             Delete the band sprite and the layer list
+***************************************************************************************/
+void TFT_eCompositor::end(void)
+{
+  _band.deleteSprite();
+
+  if (_layer) free(_layer);
+  _layer     = nullptr;
+  _layers    = 0;
+  _maxLayers = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           setBackground
+** Description:             Set the colour the band is cleared to
+***************************************************************************************/
+void TFT_eCompositor::setBackground(uint16_t color)
+{
+  _bg = color;
+}
+
+
+/***************************************************************************************
+** Function name:           newLayer
+** Description:             Add a layer to the top of the list, returns index or -1
+***************************************************************************************/
+int16_t TFT_eCompositor::newLayer(uint8_t type, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if (_layers >= _maxLayers) return -1;
+
+  layer_t *l = _layer + _layers;
+  memset(l, 0, sizeof(layer_t));
+  l->type    = type;
+  l->visible = true;
+  l->x = x; l->y = y; l->w = w; l->h = h;
+
+  return _layers++;
+}
+
+
+/***************************************************************************************
+** Function name:           addRect
+** Description:             Add a filled rectangle layer
+***************************************************************************************/
+int16_t TFT_eCompositor::addRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  int16_t i = newLayer(LAYER_RECT, x, y, w, h);
+  if (i >= 0) _layer[i].color = color;
+  return i;
+}
+
+
+/***************************************************************************************
+** Function name:           addSprite
+** Description:             Add a sprite layer, all pixels drawn
+***************************************************************************************/
+int16_t TFT_eCompositor::addSprite(TFT_eSprite *spr, int16_t x, int16_t y)
+{
+  int16_t i = newLayer(LAYER_SPRITE, x, y, 0, 0);
+  if (i >= 0) _layer[i].spr = spr;
+  return i;
+}
+
+
+/***************************************************************************************
+** Function name:           addSprite
+** Description:             Add a sprite layer with a transparent colour
+***************************************************************************************/
+int16_t TFT_eCompositor::addSprite(TFT_eSprite *spr, int16_t x, int16_t y, uint16_t transparent)
+{
+  int16_t i = newLayer(LAYER_SPRITE, x, y, 0, 0);
+  if (i >= 0) {
+    _layer[i].spr    = spr;
+    _layer[i].color  = transparent;
+    _layer[i].transp = true;
+  }
+  return i;
+}
+
+
+/***************************************************************************************
+** Function name:           addString
+** Description:             Add a string layer
+***************************************************************************************/
+int16_t TFT_eCompositor::addString(const char *string, int16_t x, int16_t y, uint8_t font, uint8_t datum,
+                                   uint16_t fg, uint16_t bg, bool fill)
+{
+  int16_t i = newLayer(LAYER_STRING, x, y, 0, 0);
+  if (i >= 0) {
+    layer_t *l = _layer + i;
+    l->string = string;
+    l->font   = font;
+    l->datum  = datum;
+    l->color  = fg;
+    l->bg     = bg;
+    l->transp = fill;
+  }
+  return i;
+}
+
+
+/***************************************************************************************
+** Function name:           addLayer
+** Description:             Add a layer drawn by a callback function
+***************************************************************************************/
+int16_t TFT_eCompositor::addLayer(drawLayerCallback draw, void *param, int16_t y, int16_t h)
+{
+  if (draw == nullptr) return -1;
+
+  int16_t i = newLayer(LAYER_CALLBACK, 0, y, 0, h);
+  if (i >= 0) {
+    _layer[i].draw  = draw;
+    _layer[i].param = param;
+  }
+  return i;
+}
+
+
+/***************************************************************************************
+** Function name:           moveLayer
+** Description:             Move a layer to x, y
+***************************************************************************************/
+void TFT_eCompositor::moveLayer(int16_t layer, int16_t x, int16_t y)
+{
+  if (layer < 0 || layer >= _layers) return;
+  _layer[layer].x = x;
+  _layer[layer].y = y;
+}
+
+
+/***************************************************************************************
+** Function name:           showLayer
+** Description:             Show or hide a layer
+***************************************************************************************/
+void TFT_eCompositor::showLayer(int16_t layer, bool visible)
+{
+  if (layer < 0 || layer >= _layers) return;
+  _layer[layer].visible = visible;
+}
+
+
+/***************************************************************************************
+** Function name:           clearLayers
+** Description:             Remove all layers
+***************************************************************************************/
+void TFT_eCompositor::clearLayers(void)
+{
+  _layers = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           drawSprite - private helper for render
+** Description:             Copy the sprite rows that are in the band to the band
+***************************************************************************************/
+// Only the band rows of the sprite are read, a 16-bit sprite that is not rotated is copied
+// straight from its buffer, other colour depths through readPixel().
+void TFT_eCompositor::drawSprite(const layer_t *l, int32_t top, int32_t rows)
+{
+  TFT_eSprite *spr = l->spr;
+  if (!spr->created()) return;
+
+  int32_t sw = spr->width(), sh = spr->height();
+
+  // Area rows and columns covered by the sprite and the band
+  int32_t y0 = (l->y > top) ? l->y : top;
+  int32_t y1 = (l->y + sh < top + rows) ? l->y + sh : top + rows;
+  int32_t x0 = (l->x > 0) ? l->x : 0;
+  int32_t x1 = (l->x + sw < _width) ? l->x + sw : _width;
+  if (y0 >= y1 || x0 >= x1) return;
+
+  // Sprite and band buffers both hold swapped bytes
+  bool raw = (spr->getColorDepth() == 16) && (spr->getRotation() == 0);
+  const uint16_t *img = (const uint16_t *)spr->getPointer();
+  uint16_t transp = l->color >> 8 | l->color << 8;
+  uint16_t *band = (uint16_t *)_band.getPointer();
+
+  for (int32_t y = y0; y < y1; y++) {
+    uint16_t *d = band + (y - top) * _width;
+    if (raw) {
+      const uint16_t *s = img + (y - l->y) * sw - l->x;
+      if (!l->transp) { memcpy(d + x0, s + x0, (x1 - x0) * 2); continue; }
+      for (int32_t x = x0; x < x1; x++) if (s[x] != transp) d[x] = s[x];
+    }
+    else {
+      for (int32_t x = x0; x < x1; x++) {
+        uint16_t c = spr->readPixel(x - l->x, y - l->y);
+        c = c >> 8 | c << 8;
+        if (!l->transp || c != transp) d[x] = c;
+      }
+    }
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           render
+** Description:             Draw the whole area on the TFT at x, y
+***************************************************************************************/
+void TFT_eCompositor::render(int32_t x, int32_t y)
+{
+  render(x, y, 0, _height);
+}
+
+
+/***************************************************************************************
+** Function name:           render
+** Description:             Draw area rows top to top + rows - 1 on the TFT at x, y
+***************************************************************************************/
+void TFT_eCompositor::render(int32_t x, int32_t y, int32_t top, int32_t rows)
+{
+  if (!_band.created()) return;
+
+  if (top < 0) { rows += top; top = 0; }
+  if (top + rows > _height) rows = _height - top;
+
+  for (int32_t by = top; by < top + rows; by += _bandRows) {
+    int32_t bh = (top + rows - by < _bandRows) ? top + rows - by : _bandRows;
+
+    // Area coordinates are drawn in the band, clipped to its bh rows
+    _band.setViewport(0, -by, _width, by + bh, true);
+    _band.fillSprite(_bg);
+
+    for (uint8_t i = 0; i < _layers; i++) {
+      const layer_t *l = _layer + i;
+      if (!l->visible) continue;
+
+      switch (l->type) {
+        case LAYER_RECT:
+          _band.fillRect(l->x, l->y, l->w, l->h, l->color);
+          break;
+
+        case LAYER_SPRITE:
+          drawSprite(l, by, bh);
+          break;
+
+        case LAYER_STRING: {
+          // Any datum puts the text within a font height of y
+          int32_t fh = _band.fontHeight(l->font);
+          if (l->y + fh < by || l->y - fh >= by + bh) break;
+          if (l->transp) _band.setTextColor(l->color, l->bg, true);
+          else _band.setTextColor(l->color);
+          _band.setTextDatum(l->datum);
+          _band.drawString(l->string, l->x, l->y, l->font);
+          break;
+        }
+
+        case LAYER_CALLBACK:
+          if (l->y + l->h <= by || l->y >= by + bh) break;
+          l->draw(&_band, l->param);
+          break;
+      }
+    }
+
+    _band.resetViewport();
+    if (bh == _bandRows) _band.pushSprite(x, y + by);
+    else _band.pushSprite(x, y + by, 0, 0, _width, bh);
+  }
+}
@@ -0,0 +1,87 @@
+/***************************************************************************************
+// The following class renders a screen area from a list of layers a band of rows at a
+// time. Each band is drawn into a small 16-bit sprite and pushed to the TFT, so only
+// width x band rows x 2 bytes of RAM is needed for the band however big the area is.
+// Layers are drawn in the order they were added, later layers are on top.
+***************************************************************************************/
+
+// Draw a callback layer into the band, in the area coordinates, with any TFT_eSprite function
+typedef void (*drawLayerCallback)(TFT_eSprite *band, void *param);
+
+class TFT_eCompositor {
+
+ public:
+
+  explicit TFT_eCompositor(TFT_eSPI *tft);
+  ~TFT_eCompositor(void);
+
+           // Create the band sprite for an area w x h pixels and reserve space for maxLayers
+           // layers. RAM needed is w * bandRows * 2 bytes for the band plus the layer list
+  bool     begin(int16_t w, int16_t h, uint8_t bandRows = 16, uint8_t maxLayers = 16);
+           // Delete the band and the layers
+  void     end(void);
+
+           // Colour of the area where no layer is drawn
+  void     setBackground(uint16_t color);
+
+           // Add a layer, each returns the layer index, or -1 if the list is full
+           // Filled rectangle
+  int16_t  addRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+           // Sprite (not rotated by setRotation), optionally with a transparent colour
+  int16_t  addSprite(TFT_eSprite *spr, int16_t x, int16_t y);
+  int16_t  addSprite(TFT_eSprite *spr, int16_t x, int16_t y, uint16_t transparent);
+           // String in a GLCD/numbered font or the band smooth font, the background is filled
+           // with bg if fill is true, text is not wrapped. The string is not copied, it may be changed
+           // between renders
+  int16_t  addString(const char *string, int16_t x, int16_t y, uint8_t font, uint8_t datum,
+                     uint16_t fg, uint16_t bg = 0, bool fill = false);
+           // Anything else, e.g. anti-aliased lines and arcs, drawn by a callback. Only bands
+           // that overlap rows y to y + h - 1 call it
+  int16_t  addLayer(drawLayerCallback draw, void *param, int16_t y, int16_t h);
+
+           // Move a layer to x, y (for a callback layer y is the top of its rows)
+  void     moveLayer(int16_t layer, int16_t x, int16_t y);
+           // Hide a layer, or show it again
+  void     showLayer(int16_t layer, bool visible);
+           // Remove all layers
+  void     clearLayers(void);
+
+           // Draw the whole area with its top left corner at x, y on the TFT
+  void     render(int32_t x, int32_t y);
+           // Draw only area rows top to top + rows - 1, e.g. the rows a moving layer has changed
+  void     render(int32_t x, int32_t y, int32_t top, int32_t rows);
+
+           // The band sprite, e.g. band()->loadFont() loads a smooth font used by every string
+           // layer, or band()->setTextSize() sets the GLCD font size
+  TFT_eSprite* band(void) { return &_band; }
+
+ private:
+
+  enum { LAYER_RECT, LAYER_SPRITE, LAYER_STRING, LAYER_CALLBACK };
+
+  typedef struct {
+    uint8_t      type;
+    bool         visible;
+    bool         transp;   // Sprite has a transparent colour, or string background fill
+    uint8_t      font, datum;
+    int16_t      x, y, w, h; // Rect size, or callback rows y to y + h - 1
+    uint16_t     color, bg;
+    const char  *string;
+    TFT_eSprite *spr;
+    drawLayerCallback draw;
+    void        *param;
+  } layer_t;
+
+  int16_t  newLayer(uint8_t type, int16_t x, int16_t y, int16_t w, int16_t h);
+  void     drawSprite(const layer_t *l, int32_t top, int32_t rows);
+
+  TFT_eSPI   *_tft;
+  TFT_eSprite _band;
+
+  layer_t    *_layer;
+  uint8_t     _layers, _maxLayers;
+
+  int16_t     _width, _height;
+  uint8_t     _bandRows;
+  uint16_t    _bg;
+};
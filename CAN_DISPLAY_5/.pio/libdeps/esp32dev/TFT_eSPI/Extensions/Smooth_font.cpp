@@ -17,6 +17,45 @@ void TFT_eSPI::loadFont(const uint8_t array[])
   loadFont("", false);
 }
 
+/***************************************************************************************
+** Function name:           loadFont
+** Description:             use a font baked by Tools/Bake_Smooth_Font
+*************************************************************************************x*/
+// The header, metrics and ASCII lookup table were built on the host, so nothing is
+// parsed or allocated here and the font is ready to use immediately
+void TFT_eSPI::loadFont(const smoothFont &font)
+{
+  if (fontLoaded) unloadFont();
+
+#ifdef FONT_FS_AVAILABLE
+  fs_font = false;
+#endif
+  fontPtr = nullptr;
+
+  gFont.gArray     = font.bitmaps;
+  gFont.gCount     = font.gCount;
+  gFont.yAdvance   = font.yAdvance;
+  gFont.spaceWidth = font.spaceWidth;
+  gFont.ascent     = font.ascent;
+  gFont.descent    = font.descent;
+  gFont.maxAscent  = font.maxAscent;
+  gFont.maxDescent = font.maxDescent;
+
+  // Only read while the font is loaded
+  gUnicode  = (uint16_t*)font.unicode;
+  gHeight   =  (uint8_t*)font.height;
+  gWidth    =  (uint8_t*)font.width;
+  gxAdvance =  (uint8_t*)font.xAdvance;
+  gdY       =  (int16_t*)font.dY;
+  gdX       =   (int8_t*)font.dX;
+  gBitmap   = (uint32_t*)font.bitmap;
+  gAscii    = (uint16_t*)font.ascii;
+
+  gFormat    = font.format;
+  gBaked     = true;
+  fontLoaded = true;
+}
+
 #ifdef FONT_FS_AVAILABLE
 /***************************************************************************************
 ** Function name:           loadFont
@@ -188,10 +227,12 @@ void TFT_eSPI::loadMetrics(void)
 #endif
 
   uint16_t gNum = 0;
+  bool sorted = true;
 
   while (gNum < gFont.gCount)
   {
     gUnicode[gNum]  = (uint16_t)readInt32(); // Unicode code point value
+    if (gNum && gUnicode[gNum] < gUnicode[gNum - 1]) sorted = false;
     gHeight[gNum]   =  (uint8_t)readInt32(); // Height of glyph
     gWidth[gNum]    =  (uint8_t)readInt32(); // Width of glyph
     gxAdvance[gNum] =  (uint8_t)readInt32(); // xAdvance - to move x cursor
@@ -245,6 +286,68 @@ void TFT_eSPI::loadMetrics(void)
   gFont.yAdvance = gFont.maxAscent + gFont.maxDescent;
 
   gFont.spaceWidth = (gFont.ascent + gFont.descent) * 2/7;  // Guess at space width
+
+  // getUnicodeIndex() uses a binary search, Processing normally writes the glyphs in order
+  if (!sorted) sortMetrics();
+
+  // Direct lookup table for ASCII, if there is no memory the binary search is used
+  gAscii = (uint16_t*)malloc( 128 * 2 );
+  if (gAscii)
+  {
+    memset(gAscii, 0xFF, 128 * 2);
+    for (gNum = gFont.gCount; gNum-- > 0; )
+    {
+      if (gUnicode[gNum] < 128) gAscii[gUnicode[gNum]] = gNum; // Lowest index wins for duplicates
+    }
+  }
+
+#ifdef FONT_FS_AVAILABLE
+  if (fs_font) initGlyphCache();
+#endif
+}
+
+
+/***************************************************************************************
+** Function name:           sortMetrics
+** Description:             Sort the glyph metrics into ascending Unicode order
+*************************************************************************************x*/
+// Insertion sort is stable, so duplicated codes keep their file order, and is fast
+// for fonts with only a few glyphs out of place. The glyph bitmaps are not moved.
+void TFT_eSPI::sortMetrics(void)
+{
+  for (uint16_t i = 1; i < gFont.gCount; i++)
+  {
+    uint16_t unicode = gUnicode[i];
+    if (unicode >= gUnicode[i - 1]) continue;
+
+    uint8_t  height   = gHeight[i];
+    uint8_t  width    = gWidth[i];
+    uint8_t  xAdvance = gxAdvance[i];
+    int16_t  dY       = gdY[i];
+    int8_t   dX       = gdX[i];
+    uint32_t bitmap   = gBitmap[i];
+
+    uint16_t j = i;
+    while (j > 0 && gUnicode[j - 1] > unicode)
+    {
+      gUnicode[j]  = gUnicode[j - 1];
+      gHeight[j]   = gHeight[j - 1];
+      gWidth[j]    = gWidth[j - 1];
+      gxAdvance[j] = gxAdvance[j - 1];
+      gdY[j]       = gdY[j - 1];
+      gdX[j]       = gdX[j - 1];
+      gBitmap[j]   = gBitmap[j - 1];
+      j--;
+    }
+
+    gUnicode[j]  = unicode;
+    gHeight[j]   = height;
+    gWidth[j]    = width;
+    gxAdvance[j] = xAdvance;
+    gdY[j]       = dY;
+    gdX[j]       = dX;
+    gBitmap[j]   = bitmap;
+  }
 }
 
 
@@ -254,6 +357,21 @@ void TFT_eSPI::loadMetrics(void)
 *************************************************************************************x*/
 void TFT_eSPI::unloadFont( void )
 {
+  if (gBaked)
+  {
+    // Metrics are in the baked font, nothing to free
+    gUnicode  = NULL;
+    gHeight   = NULL;
+    gWidth    = NULL;
+    gxAdvance = NULL;
+    gdY       = NULL;
+    gdX       = NULL;
+    gBitmap   = NULL;
+    gAscii    = NULL;
+    gBaked    = false;
+    gFormat   = SMOOTH_ALPHA8;
+  }
+
   if (gUnicode)
   {
     free(gUnicode);
@@ -296,6 +414,16 @@ void TFT_eSPI::unloadFont( void )
     gBitmap = NULL;
   }
 
+  if (gAscii)
+  {
+    free(gAscii);
+    gAscii = NULL;
+  }
+
+#ifdef FONT_FS_AVAILABLE
+  freeGlyphCache();
+#endif
+
   gFont.gArray = nullptr;
 
 #ifdef FONT_FS_AVAILABLE
@@ -340,15 +468,230 @@ uint32_t TFT_eSPI::readInt32(void)
 *************************************************************************************x*/
 bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 {
+  if (unicode < 128 && gAscii)
+  {
+    if (gAscii[unicode] == 0xFFFF) return false;
+    *index = gAscii[unicode];
+    return true;
+  }
+
+  // Binary search for the first glyph with this code, gUnicode[] is in ascending order
+  uint16_t lo = 0;
+  uint16_t hi = gFont.gCount;
+  while (lo < hi)
+  {
+    uint16_t mid = (lo + hi) >> 1;
+    if (gUnicode[mid] < unicode) lo = mid + 1;
+    else hi = mid;
+  }
+
+  if (lo < gFont.gCount && gUnicode[lo] == unicode)
+  {
+    *index = lo;
+    return true;
+  }
+  return false;
+}
+
+
+#ifdef FONT_FS_AVAILABLE
+/***************************************************************************************
+** Function name:           setGlyphCache
+** Description:             Set the RAM budget for caching glyph bitmaps from a font file
+*************************************************************************************x*/
+void TFT_eSPI::setGlyphCache(uint32_t bytes)
+{
+  gCacheBudget = bytes;
+  freeGlyphCache();
+  if (fontLoaded && fs_font) initGlyphCache();
+}
+
+
+/***************************************************************************************
+** Function name:           initGlyphCache
+** Description:             Allocate as many glyph slots as fit in the budget
+*************************************************************************************x*/
+// Every slot holds the largest glyph so slots can be reused without fragmenting memory,
+// fonts with one very large glyph will waste some of the budget.
+void TFT_eSPI::initGlyphCache(void)
+{
+  if (gCacheBudget == 0 || gCache) return;
+
+  uint16_t slotSize = 0;
   for (uint16_t i = 0; i < gFont.gCount; i++)
   {
-    if (gUnicode[i] == unicode)
+    uint16_t size = gWidth[i] * gHeight[i];
+    if (size > slotSize) slotSize = size;
+  }
+  if (slotSize == 0) return;
+
+  uint32_t fixed     = sizeof(glyphCache) + gFont.gCount;
+  uint32_t slotBytes = sizeof(uint32_t) + sizeof(uint16_t) + slotSize;
+  if (gCacheBudget < fixed + slotBytes) return; // Not enough for one glyph
+
+  uint32_t slots = (gCacheBudget - fixed) / slotBytes;
+  if (slots > 255) slots = 255;
+
+  uint32_t size = fixed + slots * slotBytes;
+  uint8_t* mem  = nullptr;
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+  if ( psramFound() && _psram_enable ) mem = (uint8_t*)ps_calloc(size, 1);
+  else
+#endif
+  mem = (uint8_t*)calloc(size, 1);
+  if (!mem) return;
+
+  gCache = (glyphCache*)mem;
+  gCache->used     = (uint32_t*)(mem + sizeof(glyphCache));
+  gCache->glyph    = (uint16_t*)(gCache->used + slots);
+  gCache->slotOf   = (uint8_t*)(gCache->glyph + slots);
+  gCache->bitmaps  = gCache->slotOf + gFont.gCount;
+  gCache->slotSize = slotSize;
+  gCache->slots    = slots;
+}
+
+
+/***************************************************************************************
+** Function name:           freeGlyphCache
+** Description:             Release the glyph cache memory
+*************************************************************************************x*/
+void TFT_eSPI::freeGlyphCache(void)
+{
+  if (gCache)
+  {
+    free(gCache);
+    gCache = nullptr;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           cachedGlyph
+** Description:             Get a glyph bitmap from the cache, reading it in on a miss
+*************************************************************************************x*/
+// Returns nullptr if there is no cache or the read fails, the caller then reads the file
+// a row at a time
+const uint8_t* TFT_eSPI::cachedGlyph(uint16_t gNum)
+{
+  if (!gCache) return nullptr;
+
+  uint8_t slot = gCache->slotOf[gNum];
+
+  if (slot)
+  {
+    slot--;
+    gCacheHits++;
+  }
+  else
+  {
+    // Replace the least recently used slot, empty slots have a zero time stamp
+    slot = 0;
+    for (uint8_t i = 1; i < gCache->slots; i++)
+    {
+      if (gCache->used[i] < gCache->used[slot]) slot = i;
+    }
+    if (gCache->used[slot]) gCache->slotOf[gCache->glyph[slot]] = 0;
+
+    // Whole bitmap in one read, called before drawGlyph() starts the TFT transaction but
+    // the sketch may hold one, so release SPI for an SD card as the row path does
+    size_t size = gWidth[gNum] * gHeight[gNum];
+    bool release = !spiffs && inTransaction;
+    if (release) endWrite();
+    fontFile.seek(gBitmap[gNum], fs::SeekSet);
+    size_t got = fontFile.read(gCache->bitmaps + slot * gCache->slotSize, size);
+    if (release) startWrite();
+    if (got != size)
     {
-      *index = i;
-      return true;
+      // Short read, the slot is left empty and the glyph is not cached
+      gCache->used[slot] = 0;
+      return nullptr;
+    }
+
+    gCache->glyph[slot]  = gNum;
+    gCache->slotOf[gNum] = slot + 1;
+    gCacheMisses++;
+  }
+
+  gCache->used[slot] = ++gCache->clock;
+  return gCache->bitmaps + slot * gCache->slotSize;
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           drawGlyphRuns
+** Description:             Draw the bitmap of a SMOOTH_RLE4 glyph at cx, cy
+*************************************************************************************x*/
+// Opaque and background runs are solid spans, only partial pixels are blended. With
+// window true (TFT, glyph inside the viewport) each stretch of a row that is written is
+// one address window, otherwise the spans go through drawFastHLine() and drawPixel().
+// readBG blends with readPixel(), else getColor() is used if set.
+void TFT_eSPI::drawGlyphRuns(uint16_t gNum, int32_t cx, int32_t cy, int32_t bx, uint16_t fg, uint16_t bg, bool readBG, bool window)
+{
+  const uint8_t* ptr = (const uint8_t*)gFont.gArray + gBitmap[gNum];
+  int32_t w = gWidth[gNum];
+
+  if (getColor) window = false; // The callback may read the TFT
+
+  for (int32_t y = cy; y < cy + gHeight[gNum]; y++)
+  {
+    int32_t x = 0;
+    bool open = false; // Address window set at the current x
+
+    while (x < w)
+    {
+      uint8_t run = pgm_read_byte(ptr++);
+      int32_t n = (run & 0x3F) + 1;
+
+      if (run < 0x40) // Transparent
+      {
+        int32_t xs = x < bx ? bx : x;
+        if (_fillbg && xs < x + n)
+        {
+          if (window) {
+            if (!open || xs > x) { setWindow(cx + xs + _xDatum, y + _yDatum, cx + w - 1 + _xDatum, y + _yDatum); open = true; }
+            pushBlock(bg, x + n - xs);
+          }
+          else drawFastHLine(cx + xs, y, x + n - xs, bg);
+        }
+        else open = false;
+      }
+      else if (run < 0x80) // Opaque
+      {
+        if (window) {
+          if (!open) { setWindow(cx + x + _xDatum, y + _yDatum, cx + w - 1 + _xDatum, y + _yDatum); open = true; }
+          pushBlock(fg, n);
+        }
+        else drawFastHLine(cx + x, y, n, fg);
+      }
+      else // Partial, 4-bit alpha high nibble first
+      {
+        uint8_t  alpha[64];
+        uint16_t color[64];
+        for (int32_t i = 0; i < n; i += 2)
+        {
+          uint8_t nibbles = pgm_read_byte(ptr++);
+          alpha[i]     = (nibbles >> 4)   * 0x11;
+          alpha[i + 1] = (nibbles & 0x0F) * 0x11;
+        }
+        for (int32_t i = 0; i < n; i++)
+        {
+          if (readBG) color[i] = readPixel(cx + x + i, y);
+          else if (getColor) color[i] = getColor(cx + x + i, y);
+          else color[i] = bg;
+        }
+        alphaBlendSpan(alpha, fg, color, n);
+        if (window) {
+          if (!open) { setWindow(cx + x + _xDatum, y + _yDatum, cx + w - 1 + _xDatum, y + _yDatum); open = true; }
+          bool swap = _swapBytes; _swapBytes = true;
+          pushPixels(color, n);
+          _swapBytes = swap;
+        }
+        else for (int32_t i = 0; i < n; i++) drawPixel(cx + x + i, y, color[i]);
+      }
+      x += n;
     }
   }
-  return false;
 }
 
 
@@ -408,10 +751,15 @@ void TFT_eSPI::drawGlyph(uint16_t code)
     const uint8_t* gPtr = (const uint8_t*) gFont.gArray;
 
 #ifdef FONT_FS_AVAILABLE
+    const uint8_t* gCached = nullptr;
     if (fs_font)
     {
-      fontFile.seek(gBitmap[gNum], fs::SeekSet);
-      pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+      gCached = cachedGlyph(gNum);
+      if (!gCached)
+      {
+        fontFile.seek(gBitmap[gNum], fs::SeekSet);
+        pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+      }
     }
 #endif
 
@@ -458,10 +806,18 @@ void TFT_eSPI::drawGlyph(uint16_t code)
       }
     }
 
+    if (gFormat == SMOOTH_RLE4)
+    {
+      int32_t xd = cx + _xDatum;
+      int32_t yd = cy + _yDatum;
+      bool clip = xd < _vpX || xd + gWidth[gNum] > _vpW || yd < _vpY || yd + gHeight[gNum] > _vpH;
+      drawGlyphRuns(gNum, cx, cy, bx, fg, bg, false, !clip);
+    }
+    else
     for (int32_t y = 0; y < gHeight[gNum]; y++)
     {
 #ifdef FONT_FS_AVAILABLE
-      if (fs_font) {
+      if (pbuffer) {
         if (spiffs)
         {
           fontFile.read(pbuffer, gWidth[gNum]);
@@ -480,9 +836,17 @@ void TFT_eSPI::drawGlyph(uint16_t code)
       for (int32_t x = 0; x < gWidth[gNum]; x++)
       {
 #ifdef FONT_FS_AVAILABLE
-        if (fs_font) pixel = pbuffer[x];
+        if (gCached) pixel = gCached[x + gWidth[gNum] * y];
+        else if (fs_font) pixel = pbuffer[x];
         else
 #endif
+        if (gFormat == SMOOTH_ALPHA4)
+        {
+          uint32_t i = x + gWidth[gNum] * y;
+          pixel = pgm_read_byte(gPtr + gBitmap[gNum] + (i >> 1));
+          pixel = ((i & 1) ? (pixel & 0x0F) : (pixel >> 4)) * 0x11;
+        }
+        else
         pixel = pgm_read_byte(gPtr + gBitmap[gNum] + x + gWidth[gNum] * y);
 
         if (pixel)
@@ -5,12 +5,18 @@
 
   // These are for the new anti-aliased fonts
   void     loadFont(const uint8_t array[]);
+  void     loadFont(const smoothFont &font); // Baked font, metrics are used in place
 #ifdef FONT_FS_AVAILABLE
   void     loadFont(String fontName, fs::FS &ffs);
 #endif
   void     loadFont(String fontName, bool flash = true);
   void     unloadFont( void );
   bool     getUnicodeIndex(uint16_t unicode, uint16_t *index);
+#ifdef FONT_FS_AVAILABLE
+           // Keep recently drawn glyph bitmaps of a font file in RAM (PSRAM if enabled),
+           // bytes = 0 turns the cache off. Applies to the loaded font and later loads.
+  void     setGlyphCache(uint32_t bytes);
+#endif
 
   virtual void drawGlyph(uint16_t code);
 
@@ -32,15 +38,18 @@
 fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
 
   // These are for the metrics for each individual glyph (so we don't need to seek this in file and waste time)
-  uint16_t* gUnicode = NULL;  //UTF-16 code, the codes are searched so do not need to be sequential
+  uint16_t* gUnicode = NULL;  //UTF-16 code, sorted into ascending order by loadMetrics() for a binary search
   uint8_t*  gHeight = NULL;   //cheight
   uint8_t*  gWidth = NULL;    //cwidth
   uint8_t*  gxAdvance = NULL; //setWidth
   int16_t*  gdY = NULL;       //topExtent
   int8_t*   gdX = NULL;       //leftExtent
   uint32_t* gBitmap = NULL;   //file pointer to greyscale bitmap
+  uint16_t* gAscii = NULL;    //glyph index for codes 0-127, 0xFFFF if not in the font
 
   bool     fontLoaded = false; // Flags when a anti-aliased font is loaded
+  bool     gBaked     = false; // Metrics point at a baked smoothFont, not the heap
+  uint8_t  gFormat    = SMOOTH_ALPHA8; // Bitmap encoding
 
 #ifdef FONT_FS_AVAILABLE
   fs::File fontFile;
@@ -48,6 +57,9 @@ fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
   bool     spiffs   = true;
   bool     fs_font = false;    // For ESP32/8266 use smooth font file or FLASH (PROGMEM) array
 
+  uint32_t gCacheHits   = 0;   // Glyphs drawn from the cache
+  uint32_t gCacheMisses = 0;   // Glyphs read from the file into the cache
+
 #else
   bool     fontFile = true;
 #endif
@@ -55,7 +67,31 @@ fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
   private:
 
   void     loadMetrics(void);
+  void     sortMetrics(void);
   uint32_t readInt32(void);
+  void     drawGlyphRuns(uint16_t gNum, int32_t cx, int32_t cy, int32_t bx, uint16_t fg, uint16_t bg, bool readBG, bool window);
+
+#ifdef FONT_FS_AVAILABLE
+  // Least recently used glyph bitmap cache, one allocation laid out as:
+  // glyphCache, used[slots], glyph[slots], slotOf[gCount], bitmaps[slots * slotSize]
+  typedef struct
+  {
+    uint32_t  clock;     // Use counter for the LRU time stamps
+    uint32_t* used;      // Time stamp of the last use of each slot, 0 if empty
+    uint16_t* glyph;     // Glyph number held by each slot
+    uint8_t*  slotOf;    // Slot number + 1 holding each glyph, 0 if not cached
+    uint8_t*  bitmaps;   // Glyph bitmaps, one per slot
+    uint16_t  slotSize;  // Bytes per slot, the largest glyph bitmap in the font
+    uint8_t   slots;     // Number of slots
+  } glyphCache;
+
+  void     initGlyphCache(void);
+  void     freeGlyphCache(void);
+  const uint8_t* cachedGlyph(uint16_t gNum);
+
+  glyphCache* gCache = nullptr;
+  uint32_t gCacheBudget = 0;   // Bytes set by setGlyphCache()
+#endif
 
   uint8_t* fontPtr = nullptr;
 
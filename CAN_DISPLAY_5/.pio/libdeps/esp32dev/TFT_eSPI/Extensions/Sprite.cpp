@@ -406,19 +406,101 @@ bool TFT_eSprite::pushRotated(int16_t angle, uint32_t transp)
   // Get the bounding box of this rotated source Sprite relative to Sprite pivot
   if ( !getRotatedBounds(angle, &min_x, &min_y, &max_x, &max_y) ) return false;
 
-  uint16_t sline_buffer[max_x - min_x + 1];
+  _tft->startWrite(); // Avoid transaction overhead for every tft pixel
+  pushRotatedBox(nullptr, min_x, min_y, max_x, max_y, transp);
+  _tft->endWrite(); // End transaction
 
-  int32_t xt = min_x - _tft->_xPivot;
-  int32_t yt = min_y - _tft->_yPivot;
-  uint32_t xe = _dwidth << FP_SCALE;
-  uint32_t ye = _dheight << FP_SCALE;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           pushRotated - Fast fixed point integer maths version
+** Description:             Push a rotated copy of the Sprite to another Sprite
+***************************************************************************************/
+// Not compatible with 4bpp
+bool TFT_eSprite::pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp)
+{
+  if ( !_created  || _bpp == 4) return false; // Check this Sprite is created
+  if ( !spr->_created  || spr->_bpp == 4) return false;  // Ckeck destination Sprite is created
+
+  // Bounding box parameters
+  int16_t min_x;
+  int16_t min_y;
+  int16_t max_x;
+  int16_t max_y;
+
+  // Get the bounding box of this rotated source Sprite
+  if ( !getRotatedBounds(spr, angle, &min_x, &min_y, &max_x, &max_y) ) return false;
+
+  bool oldSwapBytes = spr->getSwapBytes();
+  spr->setSwapBytes(false);
+  pushRotatedBox(spr, min_x, min_y, max_x, max_y, transp);
+  spr->setSwapBytes(oldSwapBytes);
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           pushRotatedBox
+** Description:             Pick the pushRotated() row kernel for the colour depth
+***************************************************************************************/
+void TFT_eSprite::pushRotatedBox(TFT_eSprite *spr, int16_t min_x, int16_t min_y, int16_t max_x, int16_t max_y,
+                                 uint32_t transp)
+{
+  TFT_eSPI *dest = spr ? (TFT_eSPI *)spr : _tft;
+  int32_t xt = min_x - dest->_xPivot;
+  int32_t yt = min_y - dest->_yPivot;
   uint16_t tpcolor = (uint16_t)transp;
 
   if (transp != 0x00FFFFFF) {
     if (_bpp == 4) tpcolor = _colorMap[transp & 0x0F];
     tpcolor = tpcolor>>8 | tpcolor<<8; // Working with swapped color bytes
   }
-  _tft->startWrite(); // Avoid transaction overhead for every tft pixel
+
+  // 16bpp pixels are always read straight from the buffer, other depths only
+  // when readPixel() would not offset or clip them
+  uint8_t bpp = (_bpp == 16 || plainLayout()) ? _bpp : 0;
+
+  #define ROTATED_ROWS(B) \
+    if (transp != 0x00FFFFFF) pushRotatedRows<B, true>(spr, min_x, min_y, max_x, max_y, xt, yt, tpcolor); \
+    else pushRotatedRows<B, false>(spr, min_x, min_y, max_x, max_y, xt, yt, tpcolor)
+
+  switch (bpp) {
+    case 16: ROTATED_ROWS(16); break;
+    case 8:  ROTATED_ROWS(8);  break;
+    case 4:  ROTATED_ROWS(4);  break;
+    case 1:  ROTATED_ROWS(1);  break;
+    default: ROTATED_ROWS(0);  break;
+  }
+  #undef ROTATED_ROWS
+}
+
+
+/***************************************************************************************
+** Function name:           pushRotatedRows
+** Description:             Scan the bounding box and push the transformed Sprite pixels
+***************************************************************************************/
+template <uint8_t BPP, bool TRANSP>
+void TFT_eSprite::pushRotatedRows(TFT_eSprite *spr, int16_t min_x, int16_t min_y, int16_t max_x, int16_t max_y,
+                                  int32_t xt, int32_t yt, uint16_t tpcolor)
+{
+  uint16_t sline_buffer[max_x - min_x + 1];
+  uint16_t palette[16];
+  rotatedPalette(palette);
+
+  uint32_t xe = _dwidth << FP_SCALE;
+  uint32_t ye = _dheight << FP_SCALE;
+  int32_t  stride = (BPP == 1) ? _bitwidth : _iwidth;
+
+  auto flush = [&](int32_t x, int32_t y, uint32_t n) {
+    if (spr) spr->pushImage(x, y, n, 1, sline_buffer);
+    else {
+      // TFT window is already clipped, so this is faster than pushImage()
+      _tft->setWindow(x, y, x + n - 1, y);
+      _tft->pushPixels(sline_buffer, n);
+    }
+  };
 
   // Scan destination bounding box and fetch transformed pixels from source Sprite
   for (int32_t y = min_y; y <= max_y; y++, yt++) {
@@ -431,16 +513,14 @@ bool TFT_eSprite::pushRotated(int16_t angle, uint32_t transp)
 
     uint32_t pixel_count = 0;
     do {
-      uint32_t rp;
+      uint16_t rp;
       int32_t xp = xs >> FP_SCALE;
       int32_t yp = ys >> FP_SCALE;
-      if (_bpp == 16) {rp = _img[xp + yp * _iwidth]; }
-      else { rp = readPixel(xp, yp); rp = (uint16_t)(rp>>8 | rp<<8); }
-      if (transp != 0x00FFFFFF && tpcolor == rp) {
+      if (BPP == 0) { rp = readPixel(xp, yp); rp = rp>>8 | rp<<8; }
+      else rp = rotatedPixel<BPP>(xp + yp * stride, palette);
+      if (TRANSP && tpcolor == rp) {
         if (pixel_count) {
-          // TFT window is already clipped, so this is faster than pushImage()
-          _tft->setWindow(x - pixel_count, y, x - 1, y);
-          _tft->pushPixels(sline_buffer, pixel_count);
+          flush(x - pixel_count, y, pixel_count);
           pixel_count = 0;
         }
       }
@@ -448,84 +528,228 @@ bool TFT_eSprite::pushRotated(int16_t angle, uint32_t transp)
         sline_buffer[pixel_count++] = rp;
       }
     } while (++x < max_x && (xs += _cosra) < xe && (ys += _sinra) < ye);
-    if (pixel_count) {
-      // TFT window is already clipped, so this is faster than pushImage()
-      _tft->setWindow(x - pixel_count, y, x - 1, y);
-      _tft->pushPixels(sline_buffer, pixel_count);
-    }
+    if (pixel_count) flush(x - pixel_count, y, pixel_count);
   }
+}
 
-  _tft->endWrite(); // End transaction
 
-  return true;
+/***************************************************************************************
+** Function name:           rotatedPixel
+** Description:             Sprite pixel i (x + y * width) as a byte swapped 565 colour
+***************************************************************************************/
+template <uint8_t BPP>
+uint16_t TFT_eSprite::rotatedPixel(uint32_t i, const uint16_t *palette)
+{
+  if (BPP == 16) return _img[i];
+
+  if (BPP == 8) {
+    uint16_t color = _img8[i];
+    uint8_t  blue[] = {0, 11, 21, 31};
+    color =   (color & 0xE0)<<8 | (color & 0xC0)<<5
+            | (color & 0x1C)<<6 | (color & 0x1C)<<3
+            | blue[color & 0x03];
+    return color>>8 | color<<8;
+  }
+
+  if (BPP == 4) return palette[(i & 0x01) ? _img4[i>>1] & 0x0F : _img4[i>>1] >> 4];
+
+  // 1bpp, MSB first
+  return palette[(_img8[i>>3] >> (~i & 0x07)) & 0x01];
 }
 
 
 /***************************************************************************************
-** Function name:           pushRotated - Fast fixed point integer maths version
-** Description:             Push a rotated copy of the Sprite to another Sprite
+** Function name:           rotatedPalette
+** Description:             Byte swapped colours of the 4bpp or 1bpp pixel values
 ***************************************************************************************/
-// Not compatible with 4bpp
-bool TFT_eSprite::pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp)
+void TFT_eSprite::rotatedPalette(uint16_t *palette)
 {
-  if ( !_created  || _bpp == 4) return false; // Check this Sprite is created
-  if ( !spr->_created  || spr->_bpp == 4) return false;  // Ckeck destination Sprite is created
+  if (_bpp == 4) {
+    for (uint8_t i = 0; i < 16; i++) palette[i] = _colorMap[i]>>8 | _colorMap[i]<<8;
+  }
+  else if (_bpp == 1) {
+    // As readPixel(), the TFT's bitmap colours
+    uint16_t bg = _tft->bitmap_bg, fg = _tft->bitmap_fg;
+    palette[0] = bg>>8 | bg<<8;
+    palette[1] = fg>>8 | fg<<8;
+  }
+}
 
-  // Bounding box parameters
-  int16_t min_x;
-  int16_t min_y;
-  int16_t max_x;
-  int16_t max_y;
 
-  // Get the bounding box of this rotated source Sprite
-  if ( !getRotatedBounds(spr, angle, &min_x, &min_y, &max_x, &max_y) ) return false;
+/***************************************************************************************
+** Function name:           plainLayout
+** Description:             True if pixel x, y is at x + y * width with no viewport
+***************************************************************************************/
+bool TFT_eSprite::plainLayout(void)
+{
+  if (_vpOoB || _xDatum || _yDatum || _vpX || _vpY) return false;
+  if (_vpW < _dwidth || _vpH < _dheight) return false;
+  return _bpp != 1 || rotation == 0;
+}
 
-  uint16_t sline_buffer[max_x - min_x + 1];
 
-  int32_t xt = min_x - spr->_xPivot;
-  int32_t yt = min_y - spr->_yPivot;
+/***************************************************************************************
+** Function name:           createRotationLUT
+** Description:             Record the Sprite pixel for each TFT pixel of pushRotated(angle)
+***************************************************************************************/
+rotationLUT* TFT_eSprite::createRotationLUT(int16_t angle)
+{
+  if ( !_created || _tft->_vpOoB || !plainLayout()) return nullptr;
+
+  int32_t stride = (_bpp == 1) ? _bitwidth : _iwidth;
+  if (stride * _dheight > 0x10000) return nullptr;
+
+  int16_t min_x, min_y, max_x, max_y;
+  uint16_t rows = 0;
+  if (getRotatedBounds(angle, &min_x, &min_y, &max_x, &max_y)) rows = max_y - min_y + 1;
+
   uint32_t xe = _dwidth << FP_SCALE;
   uint32_t ye = _dheight << FP_SCALE;
+
+  // Same scan as pushRotatedRows(), counting the pixels or recording them
+  auto scan = [&](int16_t *rx, uint16_t *rcount, uint16_t *index) {
+    uint32_t total = 0;
+    int32_t xt = min_x - _tft->_xPivot;
+    int32_t yt = min_y - _tft->_yPivot;
+    for (uint16_t r = 0; r < rows; r++, yt++) {
+      int32_t x = min_x;
+      uint32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+      uint32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+
+      while ((xs >= xe || ys >= ye) && x < max_x) { x++; xs += _cosra; ys += _sinra; }
+      int32_t x0 = x;
+      if (x < max_x) {
+        do {
+          if (index) *index++ = (xs >> FP_SCALE) + (ys >> FP_SCALE) * stride;
+        } while (++x < max_x && (xs += _cosra) < xe && (ys += _sinra) < ye);
+      }
+      if (rx) { rx[r] = x0; rcount[r] = x - x0; }
+      total += x - x0;
+    }
+    return total;
+  };
+
+  uint32_t total = scan(nullptr, nullptr, nullptr);
+  rotationLUT *lut = (rotationLUT *)malloc(sizeof(rotationLUT) + rows * (sizeof(int16_t) + sizeof(uint16_t))
+                                           + total * sizeof(uint16_t));
+  if (lut == nullptr) return nullptr;
+
+  lut->angle     = angle;
+  lut->xPivot    = _xPivot;
+  lut->yPivot    = _yPivot;
+  lut->tftXPivot = _tft->_xPivot;
+  lut->tftYPivot = _tft->_yPivot;
+  lut->vpX       = _tft->_vpX;
+  lut->vpY       = _tft->_vpY;
+  lut->vpW       = _tft->_vpW;
+  lut->vpH       = _tft->_vpH;
+  lut->iwidth    = _iwidth;
+  lut->dwidth    = _dwidth;
+  lut->dheight   = _dheight;
+  lut->bpp       = _bpp;
+  lut->y         = rows ? min_y : 0;
+  lut->rows      = rows;
+  lut->x         = (int16_t *)(lut + 1);
+  lut->count     = (uint16_t *)(lut->x + rows);
+  lut->index     = lut->count + rows;
+
+  scan(lut->x, lut->count, lut->index);
+
+  lut->span = 0;
+  for (uint16_t r = 0; r < rows; r++) if (lut->count[r] > lut->span) lut->span = lut->count[r];
+
+  return lut;
+}
+
+
+/***************************************************************************************
+** Function name:           deleteRotationLUT
+** Description:             Free a LUT made by createRotationLUT()
+***************************************************************************************/
+void TFT_eSprite::deleteRotationLUT(rotationLUT *lut)
+{
+  free(lut);
+}
+
+
+/***************************************************************************************
+** Function name:           pushRotated
+** Description:             Push rotated Sprite to TFT screen using a LUT for the angle
+***************************************************************************************/
+bool TFT_eSprite::pushRotated(const rotationLUT *lut, uint32_t transp)
+{
+  if ( lut == nullptr || !_created || _tft->_vpOoB) return false;
+
+  // Recalculate if anything the LUT depends on has changed
+  if ( lut->xPivot != _xPivot || lut->yPivot != _yPivot ||
+       lut->tftXPivot != _tft->_xPivot || lut->tftYPivot != _tft->_yPivot ||
+       lut->vpX != _tft->_vpX || lut->vpY != _tft->_vpY || lut->vpW != _tft->_vpW || lut->vpH != _tft->_vpH ||
+       lut->iwidth != _iwidth || lut->dwidth != _dwidth || lut->dheight != _dheight ||
+       lut->bpp != _bpp || !plainLayout() ) return pushRotated(lut->angle, transp);
+
+  if (lut->rows == 0) return false; // Outside of TFT viewport
+
   uint16_t tpcolor = (uint16_t)transp;
-  
   if (transp != 0x00FFFFFF) {
     if (_bpp == 4) tpcolor = _colorMap[transp & 0x0F];
     tpcolor = tpcolor>>8 | tpcolor<<8; // Working with swapped color bytes
   }
 
-  bool oldSwapBytes = spr->getSwapBytes();
-  spr->setSwapBytes(false);
+  #define ROTATED_LUT(B) \
+    if (transp != 0x00FFFFFF) pushRotatedLUT<B, true>(lut, tpcolor); \
+    else pushRotatedLUT<B, false>(lut, tpcolor)
 
-  // Scan destination bounding box and fetch transformed pixels from source Sprite
-  for (int32_t y = min_y; y <= max_y; y++, yt++) {
-    int32_t x = min_x;
-    uint32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
-    uint32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+  _tft->startWrite(); // Avoid transaction overhead for every tft pixel
+  switch (_bpp) {
+    case 16: ROTATED_LUT(16); break;
+    case 8:  ROTATED_LUT(8);  break;
+    case 4:  ROTATED_LUT(4);  break;
+    default: ROTATED_LUT(1);  break;
+  }
+  _tft->endWrite(); // End transaction
+  #undef ROTATED_LUT
 
-    while ((xs >= xe || ys >= ye) && x < max_x) { x++; xs += _cosra; ys += _sinra; }
-    if (x == max_x) continue;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           pushRotatedLUT
+** Description:             Push the LUT rows, gathering the pixels from the Sprite
+***************************************************************************************/
+template <uint8_t BPP, bool TRANSP>
+void TFT_eSprite::pushRotatedLUT(const rotationLUT *lut, uint16_t tpcolor)
+{
+  uint16_t sline_buffer[lut->span + 1];
+  uint16_t palette[16];
+  rotatedPalette(palette);
+
+  const uint16_t *index = lut->index;
+  int32_t y = lut->y;
+
+  for (uint16_t r = 0; r < lut->rows; r++, y++) {
+    int32_t x  = lut->x[r];
+    int32_t xe = x + lut->count[r];
 
     uint32_t pixel_count = 0;
-    do {
-      uint32_t rp;
-      int32_t xp = xs >> FP_SCALE;
-      int32_t yp = ys >> FP_SCALE;
-      if (_bpp == 16) rp = _img[xp + yp * _iwidth];
-      else { rp = readPixel(xp, yp); rp = (uint16_t)(rp>>8 | rp<<8); }
-      if (transp != 0x00FFFFFF && tpcolor == rp) {
+    for (; x < xe; x++) {
+      uint16_t rp = rotatedPixel<BPP>(*index++, palette);
+      if (TRANSP && tpcolor == rp) {
         if (pixel_count) {
-          spr->pushImage(x - pixel_count, y, pixel_count, 1, sline_buffer);
+          _tft->setWindow(x - pixel_count, y, x - 1, y);
+          _tft->pushPixels(sline_buffer, pixel_count);
           pixel_count = 0;
         }
       }
       else {
         sline_buffer[pixel_count++] = rp;
       }
-    } while (++x < max_x && (xs += _cosra) < xe && (ys += _sinra) < ye);
-    if (pixel_count) spr->pushImage(x - pixel_count, y, pixel_count, 1, sline_buffer);
+    }
+    if (pixel_count) {
+      _tft->setWindow(x - pixel_count, y, x - 1, y);
+      _tft->pushPixels(sline_buffer, pixel_count);
+    }
   }
-  spr->setSwapBytes(oldSwapBytes);
-  return true;
 }
 
 
@@ -1470,24 +1694,21 @@ void TFT_eSprite::scroll(int16_t dx, int16_t dy)
       fyp += iw;
     }
   }
-  else if (_bpp == 4)
+  else if ((_bpp == 4 || _bpp == 1) && rotation == 0 && !_xDatum && !_yDatum && !_vpOoB &&
+           (int32_t)_sx >= _vpX && (int32_t)_sy >= _vpY && (int32_t)(_sx + _sw) <= _vpW && (int32_t)(_sy + _sh) <= _vpH)
   {
-    // could optimize for scrolling by even # pixels using memove (later)
-    if (dx >  0) { tx += w; fx += w; } // Start from right edge
+    // Scroll zone inside the viewport, so no pixel is clipped: move whole rows of packed pixels
+    uint8_t *buf = (_bpp == 4) ? _img4 : _img8;
     while (h--)
-    { // move pixels one by one
-      for (uint16_t xp = 0; xp < w; xp++)
-      {
-        if (dx <= 0) drawPixel(tx + xp, ty, readPixelValue(fx + xp, fy));
-        if (dx >  0) drawPixel(tx - xp, ty, readPixelValue(fx - xp, fy));
-      }
-      if (dy <= 0)  { ty++; fy++; }
-      else  { ty--; fy--; }
+    {
+      moveBits(buf, typ * _bpp, fyp * _bpp, w * _bpp);
+      typ += iw;
+      fyp += iw;
     }
   }
-  else if (_bpp == 1 )
+  else if (_bpp == 4 || _bpp == 1)
   {
-    if (dx >  0) { tx += w; fx += w; } // Start from right edge
+    if (dx >  0) { tx += w - 1; fx += w - 1; } // Start from right edge
     while (h--)
     { // move pixels one by one
       for (uint16_t xp = 0; xp < w; xp++)
@@ -1509,6 +1730,87 @@ void TFT_eSprite::scroll(int16_t dx, int16_t dy)
 }
 
 
+/***************************************************************************************
+** Function name:           moveBits (protected function)
+** Description:             Copy bits from one bit offset in buf to another, the runs may
+**                          overlap. Pixels are packed MSB first, as for 1 and 4 bpp.
+***************************************************************************************/
+void TFT_eSprite::moveBits(uint8_t *buf, uint32_t to, uint32_t from, uint32_t bits)
+{
+  if (!bits || to == from) return;
+
+  // First and last destination bytes are partly outside the run
+  uint8_t *d0 = buf + (to >> 3);
+  uint8_t *d1 = buf + ((to + bits - 1) >> 3);
+  uint8_t  headMask = 0xFF >> (to & 7);
+  uint8_t  tailMask = 0xFF << (7 - ((to + bits - 1) & 7));
+
+  // 8 bits from bit offset p, the byte after a run may be read but its bits are masked off
+  auto bitsAt = [buf](uint32_t p) -> uint8_t {
+    uint8_t *b = buf + (p >> 3);
+    return (p & 7) ? (uint8_t)(b[0] << (p & 7) | b[1] >> (8 - (p & 7))) : b[0];
+  };
+
+  if (d0 == d1)
+  {
+    uint8_t mask = headMask & tailMask;
+    *d0 = (*d0 & ~mask) | ((bitsAt(from) >> (to & 7)) & mask);
+    return;
+  }
+
+  // Whole bytes between d0 and d1, and the source bit offset of the first one
+  uint32_t n   = d1 - d0 - 1;
+  uint32_t src = from + (8 - (to & 7));
+  uint8_t  sh  = src & 7;
+  uint8_t *s   = buf + (src >> 3);
+  uint8_t *d   = d0 + 1;
+  uint8_t  head = bitsAt(from) >> (to & 7);
+  uint8_t  tail = bitsAt(src + 8 * n);
+
+  if (to < from)
+  { // Moving towards the start of the buffer, copy forwards
+    *d0 = (*d0 & ~headMask) | (head & headMask);
+    if (!sh) memmove(d, s, n);
+    else
+    {
+      uint8_t a = *s;
+      while (n >= 4)
+      { // Four bytes from five, one 32-bit shift
+        uint32_t v = (uint32_t)a << 24 | (uint32_t)s[1] << 16 | (uint32_t)s[2] << 8 | s[3];
+        a = s[4];
+        v = v << sh | a >> (8 - sh);
+        d[0] = v >> 24; d[1] = v >> 16; d[2] = v >> 8; d[3] = v;
+        d += 4; s += 4; n -= 4;
+      }
+      while (n--) { uint8_t b = s[1]; *d++ = a << sh | b >> (8 - sh); a = b; s++; }
+    }
+    tail = bitsAt(src + 8 * (d1 - d0 - 1));
+    *d1 = (*d1 & ~tailMask) | (tail & tailMask);
+  }
+  else
+  { // Moving towards the end, copy backwards so the source is read before it is overwritten
+    *d1 = (*d1 & ~tailMask) | (tail & tailMask);
+    if (!sh) memmove(d, s, n);
+    else
+    {
+      d += n;
+      s += n;
+      uint8_t b = *s; // Byte after the last source byte used whole
+      while (n >= 4)
+      {
+        uint32_t v = (uint32_t)s[-4] << 24 | (uint32_t)s[-3] << 16 | (uint32_t)s[-2] << 8 | s[-1];
+        v = v << sh | b >> (8 - sh);
+        b = s[-4];
+        d[-4] = v >> 24; d[-3] = v >> 16; d[-2] = v >> 8; d[-1] = v;
+        d -= 4; s -= 4; n -= 4;
+      }
+      while (n--) { s--; uint8_t a = *s; *--d = a << sh | b >> (8 - sh); b = a; }
+    }
+    *d0 = (*d0 & ~headMask) | (head & headMask);
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           fillSprite
 ** Description:             Fill the whole sprite with defined colour
@@ -2190,7 +2492,7 @@ int16_t TFT_eSprite::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t fo
 
   int32_t width  = 0;
   int32_t height = 0;
-  uint32_t flash_address = 0;
+  uintptr_t flash_address = 0;
   uniCode -= 32;
 
 #ifdef LOAD_FONT2
@@ -2479,9 +2781,13 @@ void TFT_eSprite::drawGlyph(uint16_t code)
     const uint8_t* gPtr = (const uint8_t*) gFont.gArray;
 
 #ifdef FONT_FS_AVAILABLE
+    const uint8_t* gCached = nullptr;
     if (fs_font) {
-      fontFile.seek(gBitmap[gNum], fs::SeekSet); // This is slow for a significant position shift!
-      pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+      gCached = cachedGlyph(gNum);
+      if (!gCached) {
+        fontFile.seek(gBitmap[gNum], fs::SeekSet); // This is slow for a significant position shift!
+        pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+      }
     }
 #endif
 
@@ -2525,10 +2831,12 @@ void TFT_eSprite::drawGlyph(uint16_t code)
       }
     }
 
+    if (gFormat == SMOOTH_RLE4) drawGlyphRuns(gNum, cx, cy, bx, fg, bg, getBG, false);
+    else
     for (int32_t y = 0; y < gHeight[gNum]; y++)
     {
 #ifdef FONT_FS_AVAILABLE
-      if (fs_font) {
+      if (pbuffer) {
         fontFile.read(pbuffer, gWidth[gNum]);
       }
 #endif
@@ -2536,9 +2844,17 @@ void TFT_eSprite::drawGlyph(uint16_t code)
       for (int32_t x = 0; x < gWidth[gNum]; x++)
       {
 #ifdef FONT_FS_AVAILABLE
-        if (fs_font) pixel = pbuffer[x];
+        if (gCached) pixel = gCached[x + gWidth[gNum] * y];
+        else if (fs_font) pixel = pbuffer[x];
         else
 #endif
+        if (gFormat == SMOOTH_ALPHA4)
+        {
+          uint32_t i = x + gWidth[gNum] * y;
+          pixel = pgm_read_byte(gPtr + gBitmap[gNum] + (i >> 1));
+          pixel = ((i & 1) ? (pixel & 0x0F) : (pixel >> 4)) * 0x11;
+        }
+        else
         pixel = pgm_read_byte(gPtr + gBitmap[gNum] + x + gWidth[gNum] * y);
 
         if (pixel)
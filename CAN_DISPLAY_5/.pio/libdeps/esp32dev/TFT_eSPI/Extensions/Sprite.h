@@ -5,6 +5,22 @@
 // graphics are written to the Sprite rather than the TFT.
 ***************************************************************************************/
 
+// pushRotated() worked out in advance for one angle, see TFT_eSprite::createRotationLUT()
+typedef struct {
+  int16_t   angle;
+  int16_t   xPivot, yPivot;         // Sprite and TFT pivots, TFT viewport and Sprite layout
+  int16_t   tftXPivot, tftYPivot;   // it was made for
+  int32_t   vpX, vpY, vpW, vpH;
+  int32_t   iwidth, dwidth, dheight;
+  uint8_t   bpp;
+  int16_t   y;                      // First TFT row
+  uint16_t  rows;
+  uint16_t  span;                   // Most pixels in a row
+  int16_t  *x;                      // First TFT column of each row
+  uint16_t *count;                  // Pixels in each row
+  uint16_t *index;                  // Source pixel (x + y * iwidth) of each pixel, row by row
+} rotationLUT;
+
 class TFT_eSprite : public TFT_eSPI {
 
  public:
@@ -98,6 +114,17 @@ class TFT_eSprite : public TFT_eSPI {
            // Push a rotated copy of Sprite to another different Sprite with optional transparent colour
   bool     pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp = 0x00FFFFFF);
 
+           // Record which Sprite pixel lands on each TFT pixel for pushRotated(angle), for a
+           // needle or pointer drawn again and again at the same few angles. Pushing from the
+           // LUT then only copies pixels. It is valid while the Sprite size, colour depth, both
+           // pivots and the TFT viewport stay the same, pushRotated(lut) falls back to
+           // pushRotated(angle) otherwise. Returns nullptr if there is not enough memory,
+           // the Sprite has over 65536 pixels or has a viewport (or a rotation, for 1bpp).
+           // Each pixel takes 2 bytes, free the LUT with deleteRotationLUT().
+  rotationLUT* createRotationLUT(int16_t angle);
+  void     deleteRotationLUT(rotationLUT *lut);
+  bool     pushRotated(const rotationLUT *lut, uint32_t transp = 0x00FFFFFF);
+
            // Get the TFT bounding box for a rotated copy of this Sprite
   bool     getRotatedBounds(int16_t angle, int16_t *min_x, int16_t *min_y, int16_t *max_x, int16_t *max_y);
            // Get the destination Sprite bounding box for a rotated copy of this Sprite
@@ -159,8 +186,31 @@ class TFT_eSprite : public TFT_eSPI {
   void     begin_nin_write(void) { ; }
   void     end_nin_write(void) { ; }
 
+           // Sprite text is drawn a character at a time into the buffer
+  int32_t  drawStringRun(const char *string, int32_t x, int32_t y, uint8_t font, int32_t xo, int32_t w, int32_t padL, int32_t padR)
+           { (void)string; (void)x; (void)y; (void)font; (void)xo; (void)w; (void)padL; (void)padR; return -1; }
+
  protected:
 
+           // Drawing code writes sprite pixels with drawPixel() and drawFastHLine()
+  bool     directWrite(void) { return false; }
+
+           // Move a run of 1 or 4 bpp pixels, to/from are bit offsets into buf (MSB first)
+  void     moveBits(uint8_t *buf, uint32_t to, uint32_t from, uint32_t bits);
+
+           // pushRotated() rows for each colour depth (0 for any, through readPixel()), to the TFT if spr is nullptr
+  template <uint8_t BPP, bool TRANSP>
+  void     pushRotatedRows(TFT_eSprite *spr, int16_t min_x, int16_t min_y, int16_t max_x, int16_t max_y,
+                           int32_t xt, int32_t yt, uint16_t tpcolor);
+  template <uint8_t BPP, bool TRANSP>
+  void     pushRotatedLUT(const rotationLUT *lut, uint16_t tpcolor);
+  void     pushRotatedBox(TFT_eSprite *spr, int16_t min_x, int16_t min_y, int16_t max_x, int16_t max_y,
+                          uint32_t transp);
+  template <uint8_t BPP>
+  uint16_t rotatedPixel(uint32_t i, const uint16_t *palette);
+  void     rotatedPalette(uint16_t *palette);
+  bool     plainLayout(void);
+
   uint8_t  _bpp;     // bits per pixel (1, 4, 8 or 16)
   uint16_t *_img;    // pointer to 16-bit sprite
   uint8_t  *_img8;   // pointer to  1 and 8-bit sprite frame 1 or frame 2
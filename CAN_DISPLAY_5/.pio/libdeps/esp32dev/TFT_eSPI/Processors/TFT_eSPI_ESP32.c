@@ -174,6 +174,7 @@ void TFT_eSPI::gpioMode(uint8_t gpio, uint8_t mode)
 ***************************************************************************************/
 void TFT_eSPI::pushBlock(uint16_t color, uint32_t len)
 {
+  SHADOW_BLOCK(color, len);
   uint8_t colorBin[] = { (uint8_t) (color >> 8), (uint8_t) color };
   if(len) spi.writePattern(&colorBin[0], 2, 1); len--;
   while(len--) {WR_L; WR_H;}
@@ -185,6 +186,7 @@ void TFT_eSPI::pushBlock(uint16_t color, uint32_t len)
 ***************************************************************************************/
 void TFT_eSPI::pushPixels(const void* data_in, uint32_t len)
 {
+  SHADOW_PIXELS(data_in, len, !_swapBytes);
   uint8_t *data = (uint8_t*)data_in;
 
   if(_swapBytes) {
@@ -292,6 +294,7 @@ void TFT_eSPI::pushBlock(uint16_t color, uint32_t len){
 ** Description:             Write a sequence of pixels with swapped bytes
 ***************************************************************************************/
 void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, false);
 
   uint8_t* data = (uint8_t*)data_in;
   uint32_t color[16];
@@ -375,6 +378,8 @@ void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
     return;
   }
 
+  SHADOW_PIXELS(data_in, len, true);
+
   uint32_t *data = (uint32_t*)data_in;
 
   if (len > 31)
@@ -424,6 +429,7 @@ void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
 ***************************************************************************************/
 void TFT_eSPI::pushBlock(uint16_t color, uint32_t len)
 {
+  SHADOW_BLOCK(color, len);
   // Split out the colours
   uint32_t r = (color & 0xF800)>>8;
   uint32_t g = (color & 0x07E0)<<5;
@@ -493,6 +499,7 @@ void TFT_eSPI::pushBlock(uint16_t color, uint32_t len)
 ** Description:             Write a sequence of pixels
 ***************************************************************************************/
 void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, !_swapBytes);
 
   uint16_t *data = (uint16_t*)data_in;
   // ILI9488 write macro is not endianess dependant, hence !_swapBytes
@@ -505,6 +512,7 @@ void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
 ** Description:             Write a sequence of pixels with swapped bytes
 ***************************************************************************************/
 void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, false);
 
   uint16_t *data = (uint16_t*)data_in;
   // ILI9488 write macro is not endianess dependant, so swap byte macro not used here
@@ -520,6 +528,7 @@ void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
 ** Description:             Write a block of pixels of the same colour
 ***************************************************************************************/
 void TFT_eSPI::pushBlock(uint16_t color, uint32_t len){
+  SHADOW_BLOCK(color, len);
   #if defined (SSD1963_DRIVER)
   if ( ((color & 0xF800)>> 8) == ((color & 0x07E0)>> 3) && ((color & 0xF800)>> 8)== ((color & 0x001F)<< 3) )
   #else
@@ -545,6 +554,7 @@ void TFT_eSPI::pushBlock(uint16_t color, uint32_t len){
 ** Description:             Write a sequence of pixels with swapped bytes
 ***************************************************************************************/
 void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, false);
 
   uint16_t *data = (uint16_t*)data_in;
   while ( len-- ) {tft_Write_16(*data); data++;}
@@ -555,6 +565,7 @@ void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
 ** Description:             Write a sequence of pixels
 ***************************************************************************************/
 void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, !_swapBytes);
 
   uint16_t *data = (uint16_t*)data_in;
   if(_swapBytes) { while ( len-- ) {tft_Write_16(*data); data++; } }
@@ -625,6 +636,7 @@ void TFT_eSPI::pushPixelsDMA(uint16_t* image, uint32_t len)
   if(_swapBytes) {
     for (uint32_t i = 0; i < len; i++) (image[i] = image[i] << 8 | image[i] >> 8);
   }
+  SHADOW_PIXELS(image, len, true);
 
   esp_err_t ret;
   static spi_transaction_t trans;
@@ -657,6 +669,7 @@ void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t
   dmaWait();
 
   setAddrWindow(x, y, w, h);
+  SHADOW_PIXELS(image, len, true);
 
   esp_err_t ret;
   static spi_transaction_t trans;
@@ -733,6 +746,7 @@ void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t
   if (spiBusyCheck) dmaWait(); // In case we did not wait earlier
 
   setAddrWindow(x, y, dw, dh);
+  SHADOW_PIXELS(buffer, len, true);
 
   esp_err_t ret;
   static spi_transaction_t trans;
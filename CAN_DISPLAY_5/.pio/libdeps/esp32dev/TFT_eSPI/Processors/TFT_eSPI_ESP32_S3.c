@@ -157,6 +157,7 @@ void TFT_eSPI::gpioMode(uint8_t gpio, uint8_t mode)
 ***************************************************************************************/
 void TFT_eSPI::pushBlock(uint16_t color, uint32_t len)
 {
+  SHADOW_BLOCK(color, len);
   uint8_t colorBin[] = { (uint8_t) (color >> 8), (uint8_t) color };
   if(len) spi.writePattern(&colorBin[0], 2, 1); len--;
   while(len--) {WR_L; WR_H;}
@@ -168,6 +169,7 @@ void TFT_eSPI::pushBlock(uint16_t color, uint32_t len)
 ***************************************************************************************/
 void TFT_eSPI::pushPixels(const void* data_in, uint32_t len)
 {
+  SHADOW_PIXELS(data_in, len, !_swapBytes);
   uint8_t *data = (uint8_t*)data_in;
 
   if(_swapBytes) {
@@ -283,6 +285,7 @@ void TFT_eSPI::pushBlock(uint16_t color, uint32_t len){
 ** Description:             Write a sequence of pixels with swapped bytes
 ***************************************************************************************/
 void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, false);
 
   uint8_t* data = (uint8_t*)data_in;
   uint32_t color[16];
@@ -378,6 +381,8 @@ void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
     return;
   }
 
+  SHADOW_PIXELS(data_in, len, true);
+
   uint32_t *data = (uint32_t*)data_in;
 
   if (len > 31)
@@ -435,6 +440,7 @@ void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
 ***************************************************************************************/
 void TFT_eSPI::pushBlock(uint16_t color, uint32_t len)
 {
+  SHADOW_BLOCK(color, len);
   // Split out the colours
   uint32_t r = (color & 0xF800)>>8;
   uint32_t g = (color & 0x07E0)<<5;
@@ -511,6 +517,7 @@ void TFT_eSPI::pushBlock(uint16_t color, uint32_t len)
 ** Description:             Write a sequence of pixels
 ***************************************************************************************/
 void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, !_swapBytes);
 
   uint16_t *data = (uint16_t*)data_in;
   // ILI9488 write macro is not endianess dependant, hence !_swapBytes
@@ -523,6 +530,7 @@ void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
 ** Description:             Write a sequence of pixels with swapped bytes
 ***************************************************************************************/
 void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, false);
 
   uint16_t *data = (uint16_t*)data_in;
   // ILI9488 write macro is not endianess dependant, so swap byte macro not used here
@@ -538,6 +546,7 @@ void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
 ** Description:             Write a block of pixels of the same colour
 ***************************************************************************************/
 void TFT_eSPI::pushBlock(uint16_t color, uint32_t len){
+  SHADOW_BLOCK(color, len);
   if ( (color >> 8) == (color & 0x00FF) )
   { if (!len) return;
     tft_Write_16(color);
@@ -559,6 +568,7 @@ void TFT_eSPI::pushBlock(uint16_t color, uint32_t len){
 ** Description:             Write a sequence of pixels with swapped bytes
 ***************************************************************************************/
 void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, false);
 
   uint16_t *data = (uint16_t*)data_in;
   while ( len-- ) {tft_Write_16(*data); data++;}
@@ -569,6 +579,7 @@ void TFT_eSPI::pushSwapBytePixels(const void* data_in, uint32_t len){
 ** Description:             Write a sequence of pixels
 ***************************************************************************************/
 void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, !_swapBytes);
 
   uint16_t *data = (uint16_t*)data_in;
   if(_swapBytes) { while ( len-- ) {tft_Write_16(*data); data++; } }
@@ -651,6 +662,7 @@ void TFT_eSPI::pushPixelsDMA(uint16_t* image, uint32_t len)
     len -= 0x400; image+= 0x400; // Arbitrarily send 1K pixel blocks (2Kbytes)
   }
   _swapBytes = temp;
+  SHADOW_PIXELS(image, len, true); // Pixels left for the DMA transfer
 
   esp_err_t ret;
   static spi_transaction_t trans;
@@ -695,6 +707,7 @@ void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t
     len -= 0x400; buffer+= 0x400; // Arbitrarily send 1K pixel blocks (2Kbytes)
   }
   _swapBytes = temp;
+  SHADOW_PIXELS(buffer, len, true); // Pixels left for the DMA transfer
 
   esp_err_t ret;
   static spi_transaction_t trans;
@@ -783,6 +796,7 @@ void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t
     len -= 0x400; buffer+= 0x400; // Arbitrarily send 1K pixel blocks (2Kbytes)
   }
   _swapBytes = temp;
+  SHADOW_PIXELS(buffer, len, true); // Pixels left for the DMA transfer
 
   esp_err_t ret;
   static spi_transaction_t trans;
@@ -0,0 +1,403 @@
+        ////////////////////////////////////////////////////
+        //   TFT_eSPI native host (Linux) driver functions  //
+        ////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Global variables
+////////////////////////////////////////////////////////////////////////////////////////
+
+HostSerial Serial;
+
+// SPI port stand-in, returned by getSPIinstance()
+SPIClass  host_spi;
+SPIClass& spi = host_spi;
+
+#ifdef SMOOTH_FONT
+fs::FS SPIFFS;
+#endif
+
+// Display controller model state
+static uint16_t host_ram[TFT_WIDTH * TFT_HEIGHT]; // Display RAM in rotation 0 layout
+host_bus_stats host_stats;
+
+static bool     host_cs_high = true;
+static bool     host_dc_data = true;
+static uint8_t  host_cmd     = 0;     // Last command received
+static uint32_t host_param   = 0;     // Parameter byte count since last command
+static uint16_t host_args[2];         // CASET/PASET start and end
+static uint8_t  host_madctl  = 0;
+static uint16_t host_xs = 0, host_xe = TFT_WIDTH - 1, host_ys = 0, host_ye = TFT_HEIGHT - 1;
+static uint16_t host_cx = 0, host_cy = 0; // RAM write/read pointer in the address window
+static uint8_t  host_hi;                  // First byte of a pixel split across writes
+static uint16_t host_tfa = 0, host_vsa = TFT_HEIGHT; // Vertical scroll area, rows above it and its height
+static uint16_t host_vsp = 0;             // Display RAM row shown at the top of the scroll area
+static uint16_t host_scroll[3];           // VSCRDEF parameters
+
+// Controller command codes (common to the MIPI DCS style displays)
+#define HOST_CASET  0x2A
+#define HOST_PASET  0x2B
+#define HOST_RAMWR  0x2C
+#define HOST_RAMRD  0x2E
+#define HOST_VSCRDEF  0x33
+#define HOST_MADCTL   0x36
+#define HOST_VSCRSADD 0x37
+
+// MADCTL bits, as used in the TFT_Drivers xxx_Defines.h files
+#define HOST_MAD_MY 0x80
+#define HOST_MAD_MX 0x40
+#define HOST_MAD_MV 0x20
+
+/***************************************************************************************
+** Function name:           hostRamIndex
+** Description:             Map the window pointer to display RAM, -1 if off panel
+***************************************************************************************/
+static inline int32_t hostRamIndex(void)
+{
+  int32_t x = host_cx, y = host_cy;
+  if (host_madctl & HOST_MAD_MV) { int32_t t = x; x = y; y = t; }
+  if (host_madctl & HOST_MAD_MX) x = TFT_WIDTH  - 1 - x;
+  if (host_madctl & HOST_MAD_MY) y = TFT_HEIGHT - 1 - y;
+  if (x < 0 || y < 0 || x >= TFT_WIDTH || y >= TFT_HEIGHT) return -1;
+  return x + y * TFT_WIDTH;
+}
+
+/***************************************************************************************
+** Function name:           hostAdvance
+** Description:             Step the window pointer, wrapping like the controller does
+***************************************************************************************/
+static inline void hostAdvance(void)
+{
+  if (host_cx++ >= host_xe) {
+    host_cx = host_xs;
+    if (host_cy++ >= host_ye) host_cy = host_ys;
+  }
+}
+
+/***************************************************************************************
+** Function name:           hostPixel
+** Description:             Write one pixel at the window pointer
+***************************************************************************************/
+static inline void hostPixel(uint16_t color)
+{
+  int32_t i = hostRamIndex();
+  if (i >= 0) host_ram[i] = color;
+  hostAdvance();
+  host_stats.pixels++;
+}
+
+/***************************************************************************************
+** Function name:           hostData8
+** Description:             Handle one parameter or pixel data byte
+***************************************************************************************/
+static void hostData8(uint8_t d)
+{
+  switch (host_cmd) {
+    case HOST_CASET:
+    case HOST_PASET:
+      if (host_param < 4) {
+        uint16_t& arg = host_args[host_param >> 1];
+        arg = (host_param & 1) ? (arg | d) : (d << 8);
+        if (host_param == 3) {
+          if (host_cmd == HOST_CASET) { host_xs = host_args[0]; host_xe = host_args[1]; }
+          else                        { host_ys = host_args[0]; host_ye = host_args[1]; }
+        }
+      }
+      break;
+    case HOST_RAMWR:
+      if (host_param & 1) hostPixel(host_hi << 8 | d);
+      else host_hi = d;
+      break;
+    case HOST_MADCTL:
+      if (host_param == 0) host_madctl = d;
+      break;
+    case HOST_VSCRDEF:
+      if (host_param < 6) {
+        uint16_t& arg = host_scroll[host_param >> 1];
+        arg = (host_param & 1) ? (arg | d) : (d << 8);
+        if (host_param == 5 && host_scroll[0] + host_scroll[1] + host_scroll[2] == TFT_HEIGHT) {
+          host_tfa = host_scroll[0]; host_vsa = host_scroll[1];
+        }
+      }
+      break;
+    case HOST_VSCRSADD:
+      if (host_param == 0) host_vsp = d << 8;
+      else if (host_param == 1) host_vsp |= d;
+      break;
+    default:
+      break;
+  }
+  host_param++;
+}
+
+/***************************************************************************************
+** Function name:           hostCS
+** Description:             Chip select, a falling edge starts a new transaction
+***************************************************************************************/
+void hostCS(bool high)
+{
+  if (host_cs_high && !high) host_stats.transactions++;
+  host_cs_high = high;
+}
+
+/***************************************************************************************
+** Function name:           hostDC
+** Description:             Data/command line
+***************************************************************************************/
+void hostDC(bool data)
+{
+  host_dc_data = data;
+}
+
+/***************************************************************************************
+** Function name:           hostWrite
+** Description:             Clock out 1-4 bytes, MS byte first
+***************************************************************************************/
+void hostWrite(uint32_t data, uint8_t bytes)
+{
+  host_stats.bytes += bytes;
+
+  if (!host_dc_data) {
+    // Command, 16-bit command displays use the LS byte
+    host_cmd   = (uint8_t)data;
+    host_param = 0;
+    host_stats.commands++;
+    if (host_cmd == HOST_CASET) host_stats.windows++;
+    if (host_cmd == HOST_RAMWR || host_cmd == HOST_RAMRD) { host_cx = host_xs; host_cy = host_ys; }
+    return;
+  }
+
+  // Fast path for whole pixels
+  if (host_cmd == HOST_RAMWR && !(host_param & 1)) {
+    if (bytes == 2) { hostPixel((uint16_t)data); host_param += 2; return; }
+    if (bytes == 4) { hostPixel(data >> 16); hostPixel((uint16_t)data); host_param += 4; return; }
+  }
+
+  while (bytes--) hostData8((uint8_t)(data >> (8 * bytes)));
+}
+
+/***************************************************************************************
+** Function name:           hostRead8
+** Description:             Clock in a byte, RAMRD returns a dummy byte then 18-bit RGB
+***************************************************************************************/
+uint8_t hostRead8(void)
+{
+  host_stats.readBytes++;
+  if (host_cmd != HOST_RAMRD || host_param == 0) { host_param++; return 0; }
+
+  int32_t  i = hostRamIndex();
+  uint16_t c = i >= 0 ? host_ram[i] : 0;
+  uint8_t  b = 0;
+  switch ((host_param - 1) % 3) {
+    case 0: b = (c >> 8) & 0xF8; break;
+    case 1: b = (c >> 3) & 0xFC; break;
+    case 2: b = (c << 3) & 0xF8; hostAdvance(); break;
+  }
+  host_param++;
+  return b;
+}
+
+/***************************************************************************************
+** Function name:           pushBlock - for host framebuffer
+** Description:             Write a block of pixels of the same colour
+***************************************************************************************/
+void TFT_eSPI::pushBlock(uint16_t color, uint32_t len){
+  SHADOW_BLOCK(color, len);
+
+  if (host_cmd != HOST_RAMWR || (host_param & 1)) {
+    while ( len-- ) {tft_Write_16(color);}
+    return;
+  }
+
+  host_stats.bytes += len * 2;
+  host_param += len * 2;
+  while ( len-- ) hostPixel(color);
+}
+
+/***************************************************************************************
+** Function name:           pushPixels - for host framebuffer
+** Description:             Write a sequence of pixels
+***************************************************************************************/
+void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
+  SHADOW_PIXELS(data_in, len, !_swapBytes);
+
+  uint16_t *data = (uint16_t*)data_in;
+
+  if (host_cmd != HOST_RAMWR || (host_param & 1)) {
+    if (_swapBytes) while ( len-- ) {tft_Write_16(*data); data++;}
+    else while ( len-- ) {tft_Write_16S(*data); data++;}
+    return;
+  }
+
+  host_stats.bytes += len * 2;
+  host_param += len * 2;
+  if (_swapBytes) while ( len-- ) {hostPixel(*data); data++;}
+  else while ( len-- ) {hostPixel(*data << 8 | *data >> 8); data++;}
+}
+
+/***************************************************************************************
+** Function name:           framebuffer
+** Description:             Return the display RAM, TFT_WIDTH x TFT_HEIGHT RGB565 pixels
+***************************************************************************************/
+uint16_t* TFT_eSPI::framebuffer(void)
+{
+  return host_ram;
+}
+
+/***************************************************************************************
+** Function name:           screen
+** Description:             Return the displayed image, the display RAM with the scroll
+**                          area rotated so row host_vsp is at its top
+***************************************************************************************/
+uint16_t* TFT_eSPI::screen(void)
+{
+  static uint16_t shown[TFT_WIDTH * TFT_HEIGHT];
+  bool scrolled = host_vsp >= host_tfa && host_vsp < host_tfa + host_vsa;
+
+  for (uint32_t y = 0; y < TFT_HEIGHT; y++) {
+    uint32_t row = y;
+    if (scrolled && y >= host_tfa && y < (uint32_t)host_tfa + host_vsa)
+      row = host_tfa + (host_vsp - host_tfa + y - host_tfa) % host_vsa;
+    memcpy(shown + y * TFT_WIDTH, host_ram + row * TFT_WIDTH, TFT_WIDTH * sizeof(uint16_t));
+  }
+  return shown;
+}
+
+/***************************************************************************************
+** Function name:           busStats
+** Description:             Return the bus traffic counters
+***************************************************************************************/
+const host_bus_stats& TFT_eSPI::busStats(void)
+{
+  return host_stats;
+}
+
+/***************************************************************************************
+** Function name:           resetBusStats
+** Description:             Zero the bus traffic counters
+***************************************************************************************/
+void TFT_eSPI::resetBusStats(void)
+{
+  memset(&host_stats, 0, sizeof(host_stats));
+}
+
+/***************************************************************************************
+** Function name:           savePPM
+** Description:             Save the display RAM as a binary (P6) PPM image
+***************************************************************************************/
+bool TFT_eSPI::savePPM(const char *filename)
+{
+  FILE *f = fopen(filename, "wb");
+  if (!f) return false;
+
+  fprintf(f, "P6\n%d %d\n255\n", TFT_WIDTH, TFT_HEIGHT);
+  for (uint32_t i = 0; i < (uint32_t)TFT_WIDTH * TFT_HEIGHT; i++) {
+    uint16_t c = host_ram[i];
+    uint8_t rgb[3] = { (uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)((c << 3) & 0xF8) };
+    rgb[0] |= rgb[0] >> 5; rgb[1] |= rgb[1] >> 6; rgb[2] |= rgb[2] >> 5;
+    fwrite(rgb, 1, 3, f);
+  }
+  return fclose(f) == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+//                                DMA FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Host transfers complete before the call returns, so these keep the ESP32 DMA API
+// (and its byte order conventions) but never report the bus as busy.
+
+/***************************************************************************************
+** Function name:           dmaBusy
+** Description:             Check if DMA is busy
+***************************************************************************************/
+bool TFT_eSPI::dmaBusy(void)
+{
+  return false;
+}
+
+/***************************************************************************************
+** Function name:           dmaWait
+** Description:             Wait until DMA is over
+***************************************************************************************/
+void TFT_eSPI::dmaWait(void)
+{
+}
+
+/***************************************************************************************
+** Function name:           pushPixelsDMA
+** Description:             Push pixels to TFT
+***************************************************************************************/
+void TFT_eSPI::pushPixelsDMA(uint16_t* image, uint32_t len)
+{
+  if ((len == 0) || (!DMA_Enabled)) return;
+  pushPixels(image, len);
+}
+
+/***************************************************************************************
+** Function name:           pushImageDMA
+** Description:             Push image to a window
+***************************************************************************************/
+// Fixed const data assumed, will NOT clip or swap bytes
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t const* image)
+{
+  if ((w == 0) || (h == 0) || (!DMA_Enabled)) return;
+
+  uint32_t len = w*h;
+
+  setAddrWindow(x, y, w, h);
+  SHADOW_PIXELS(image, len, true);
+  begin_tft_write();
+  while ( len-- ) {tft_Write_16S(*image); image++;}
+  end_tft_write();
+}
+
+/***************************************************************************************
+** Function name:           pushImageDMA
+** Description:             Push image to a window, clipped to the viewport
+***************************************************************************************/
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* image, uint16_t* buffer)
+{
+  if ((x >= _vpW) || (y >= _vpH) || (!DMA_Enabled)) return;
+
+  int32_t dx = 0;
+  int32_t dy = 0;
+  int32_t dw = w;
+  int32_t dh = h;
+
+  if (x < _vpX) { dx = _vpX - x; dw -= dx; x = _vpX; }
+  if (y < _vpY) { dy = _vpY - y; dh -= dy; y = _vpY; }
+
+  if ((x + dw) > _vpW ) dw = _vpW - x;
+  if ((y + dh) > _vpH ) dh = _vpH - y;
+
+  if (dw < 1 || dh < 1) return;
+
+  (void)buffer; // Copy is not needed, the transfer is complete on return
+
+  setAddrWindow(x, y, dw, dh);
+  begin_tft_write();
+  for (int32_t yb = 0; yb < dh; yb++) pushPixels(image + dx + w * (yb + dy), dw);
+  end_tft_write();
+}
+
+/***************************************************************************************
+** Function name:           initDMA
+** Description:             Initialise the DMA engine - returns true if init OK
+***************************************************************************************/
+bool TFT_eSPI::initDMA(bool ctrl_cs)
+{
+  (void)ctrl_cs;
+  if (DMA_Enabled) return false;
+  DMA_Enabled = true;
+  spiBusyCheck = 0;
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           deInitDMA
+** Description:             Disconnect the DMA engine from SPI
+***************************************************************************************/
+void TFT_eSPI::deInitDMA(void)
+{
+  DMA_Enabled = false;
+}
@@ -0,0 +1,286 @@
+        ////////////////////////////////////////////////////
+        //   TFT_eSPI native host (Linux) driver functions  //
+        ////////////////////////////////////////////////////
+
+// This driver lets the library compile natively on a Linux (or other POSIX) host
+// so drawing functions can be benchmarked and regression tested without hardware.
+// Commands and pixels sent over the "bus" are decoded by a small display controller
+// model (CASET, PASET, RAMWR, RAMRD, MADCTL, VSCRDEF, VSCRSADD) into an in-memory RGB565
+// framebuffer.
+// Bytes, transactions and address window commands are counted so the SPI cost of
+// a drawing operation can be estimated for a given SPI_FREQUENCY.
+//
+// Build with HOST_FRAMEBUFFER defined and a host setup file, for example (one line):
+//   g++ -O2 -DHOST_FRAMEBUFFER -DUSER_SETUP_LOADED
+//       -include User_Setups/Setup500_Host_Framebuffer.h -I. sketch.cpp TFT_eSPI.cpp
+//
+// The framebuffer is read back with tft.framebuffer(), the image as scrolled onto the
+// panel with tft.screen(), bus statistics with tft.busStats() and a snapshot saved
+// with tft.savePPM("file.ppm").
+
+#ifndef _TFT_eSPI_HOSTH_
+#define _TFT_eSPI_HOSTH_
+
+// Processor ID reported by getSetup()
+#define PROCESSOR_ID 0x0001
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Minimal Arduino API so the library compiles without an Arduino core
+////////////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+// SSE2 span blending, see alphaBlendSpan()
+#if defined (__SSE2__)
+  #include <emmintrin.h>
+  #define HOST_SSE2
+#endif
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define HIGH   0x1
+#define LOW    0x0
+#define INPUT  0x0
+#define OUTPUT 0x1
+
+#define DEC 10
+#define HEX 16
+
+#ifndef PROGMEM
+  #define PROGMEM
+#endif
+// memcpy() keeps these free of alias and alignment problems, the compiler reduces it to a load
+static inline uint16_t  host_read_word(const void *a)  { uint16_t  v; memcpy(&v, a, sizeof(v)); return v; }
+static inline uintptr_t host_read_ptr(const void *a)   { uintptr_t v; memcpy(&v, a, sizeof(v)); return v; }
+static inline float     host_read_float(const void *a) { float     v; memcpy(&v, a, sizeof(v)); return v; }
+
+#define pgm_read_byte(addr)  (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)  host_read_word((const void *)(addr))
+#define pgm_read_dword(addr) host_read_ptr((const void *)(addr)) // The library only uses this to read pointers
+#define pgm_read_float(addr) host_read_float((const void *)(addr))
+
+template <typename A, typename B> static inline auto min(A a, B b) -> decltype(a + b) { return a < b ? a : b; }
+template <typename A, typename B> static inline auto max(A a, B b) -> decltype(a + b) { return a > b ? a : b; }
+
+inline void     pinMode(uint8_t, uint8_t) {}
+inline void     digitalWrite(uint8_t, uint8_t) {}
+inline int      digitalRead(uint8_t) { return 0; }
+inline uint32_t digitalPinToBitMask(uint8_t pin) { return 1UL << (pin & 31); }
+inline void     delay(uint32_t) {}            // Controller reset/init delays are not modelled
+inline void     delayMicroseconds(uint32_t) {}
+inline void     yield(void) {}
+inline uint32_t micros(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+inline uint32_t millis(void) { return micros() / 1000; }
+
+inline long random(long howbig) { return howbig > 0 ? ::random() % howbig : 0; }
+inline long random(long howsmall, long howbig) { return howsmall < howbig ? howsmall + random(howbig - howsmall) : howsmall; }
+
+inline char* ltoa(long value, char *buf, int base) {
+  snprintf(buf, 34, base == 16 ? "%lx" : "%ld", value); // Library callers only use base 10
+  return buf;
+}
+
+// Subset of the Arduino String class used by the library
+class String {
+ public:
+  String(const char *s = "") { set(s, strlen(s)); }
+  String(const String &s) { set(s.buf, s.len); }
+  String(char c) { set(&c, 1); }
+  String(long n, uint8_t base = DEC) { char t[24]; snprintf(t, sizeof(t), base == HEX ? "%lX" : "%ld", n); set(t, strlen(t)); }
+  String(int n, uint8_t base = DEC) : String((long)n, base) {}
+  ~String() { free(buf); }
+  String& operator = (const String &s) { if (this != &s) { free(buf); set(s.buf, s.len); } return *this; }
+  String& operator += (const String &s) {
+    char *n = (char *)malloc(len + s.len + 1);
+    memcpy(n, buf, len); memcpy(n + len, s.buf, s.len + 1);
+    free(buf); buf = n; len += s.len;
+    return *this;
+  }
+  friend String operator + (const String &a, const String &b) { String r(a); r += b; return r; }
+  bool     operator == (const String &s) const { return strcmp(buf, s.buf) == 0; }
+  unsigned int length(void) const { return len; }
+  const char*  c_str(void)  const { return buf; }
+  char     charAt(unsigned int i) const { return i < len ? buf[i] : 0; }
+  bool     endsWith(const String &s) const { return s.len <= len && strcmp(buf + len - s.len, s.buf) == 0; }
+  void     toCharArray(char *b, unsigned int size) const {
+    if (!size) return;
+    unsigned int n = len < size - 1 ? len : size - 1;
+    memcpy(b, buf, n); b[n] = 0;
+  }
+ private:
+  void set(const char *s, size_t n) { buf = (char *)malloc(n + 1); memcpy(buf, s, n); buf[n] = 0; len = n; }
+  char  *buf;
+  size_t len;
+};
+
+// Subset of the Arduino Print class (TFT_eSPI is a Print stream)
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) { size_t n = 0; while (size--) n += write(*buffer++); return n; }
+  size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+
+  size_t print(const char *s)         { return write(s); }
+  size_t print(const String &s)       { return write(s.c_str()); }
+  size_t print(char c)                { return write((uint8_t)c); }
+  size_t print(long n, int base = DEC) { char t[24]; snprintf(t, sizeof(t), base == HEX ? "%lX" : "%ld", n); return write(t); }
+  size_t print(int n, int base = DEC)           { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC)  { return print((unsigned long)n, base); }
+  size_t print(unsigned long n, int base = DEC) { char t[24]; snprintf(t, sizeof(t), base == HEX ? "%lX" : "%lu", n); return write(t); }
+  size_t print(double n, int digits = 2) { char t[32]; snprintf(t, sizeof(t), "%.*f", digits, n); return write(t); }
+  size_t println(void) { return write("\r\n"); }
+  template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+  template <typename T> size_t println(T v, int f) { size_t n = print(v, f); return n + println(); }
+};
+
+// Serial messages from the library go to stdout
+class HostSerial : public Print {
+ public:
+  void   begin(unsigned long) {}
+  size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+  using  Print::write;
+  operator bool() { return true; }
+};
+extern HostSerial Serial;
+
+// SPI port stand-in, all traffic goes through the tft_Write_xx macros below
+#define SPI_MODE0 0
+#define SPI_MODE3 3
+class SPIClass {
+ public:
+  void     begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+  void     end(void) {}
+  void     setFrequency(uint32_t) {}
+  uint8_t  transfer(uint8_t) { return 0; }
+  uint16_t transfer16(uint16_t) { return 0; }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Host bus model
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Bus and file traffic counters, reset with tft.resetBusStats()
+typedef struct {
+  uint64_t bytes;         // Bytes clocked out to the display (commands + parameters + pixels)
+  uint64_t readBytes;     // Bytes clocked in from the display
+  uint64_t pixels;        // Pixels written to display RAM
+  uint32_t commands;      // Command bytes (DC low)
+  uint32_t windows;       // Address window (CASET) commands
+  uint32_t transactions;  // CS low periods
+  uint32_t fileReads;     // fs::File read() calls, e.g. smooth font bitmaps from "SPIFFS"
+  uint32_t fileSeeks;     // fs::File seek() calls
+} host_bus_stats;
+
+extern host_bus_stats host_stats;
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Filing system stand-in, SPIFFS maps to a host directory (default is the current one)
+////////////////////////////////////////////////////////////////////////////////////////
+#ifdef SMOOTH_FONT
+namespace fs {
+  enum SeekMode { SeekSet = SEEK_SET, SeekCur = SEEK_CUR, SeekEnd = SEEK_END };
+
+  // Copies share the FILE handle, as with the Arduino File class close() must be called
+  class File {
+   public:
+    File(FILE *f = nullptr) : f(f) {}
+    int    read(void) { host_stats.fileReads++; return f ? fgetc(f) : -1; }
+    size_t read(uint8_t *buf, size_t size) { host_stats.fileReads++; return f ? fread(buf, 1, size, f) : 0; }
+    bool   seek(uint32_t pos, SeekMode mode = SeekSet) { host_stats.fileSeeks++; return f && fseek(f, pos, mode) == 0; }
+    void   close(void) { if (f) fclose(f); f = nullptr; }
+    operator bool() const { return f != nullptr; }
+   private:
+    FILE *f;
+  };
+
+  class FS {
+   public:
+    FS(const char *root = ".") : root(root) {}
+    bool begin(bool = false) { return true; }
+    void setRoot(const char *dir) { root = dir; }
+    bool exists(const String &path) { File f = open(path); bool ok = f; f.close(); return ok; }
+    File open(const String &path, const char * = "r") { return File(fopen((String(root) + path).c_str(), "rb")); }
+   private:
+    const char *root;
+  };
+}
+extern fs::FS SPIFFS;
+
+#define FONT_FS_AVAILABLE
+#endif
+
+// Controller model entry points, used by the macros below
+void     hostCS(bool high);
+void     hostDC(bool data);
+void     hostWrite(uint32_t data, uint8_t bytes);
+uint8_t  hostRead8(void);
+
+// Processor specific code used by SPI bus transaction startWrite and endWrite functions
+#define SET_BUS_WRITE_MODE // Not used
+#define SET_BUS_READ_MODE  // Not used
+
+// Code to check if DMA is busy, used by SPI bus transaction startWrite and endWrite functions
+// Host "DMA" transfers complete synchronously
+#define DMA_BUSY_CHECK // Not used so leave blank
+
+// Initialise processor specific SPI functions, used by init()
+#define INIT_TFT_DATA_BUS
+
+#if defined (TFT_PARALLEL_8_BIT) || defined (SPI_18BIT_DRIVER) || defined (RPI_DISPLAY_TYPE)
+  #error >>>>------>> Host framebuffer driver only models a 16-bit colour SPI display
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Define the DC (TFT Data/Command or Register Select (RS))pin drive code
+////////////////////////////////////////////////////////////////////////////////////////
+#define DC_C hostDC(false)
+#define DC_D hostDC(true)
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Define the CS (TFT chip select) pin drive code
+////////////////////////////////////////////////////////////////////////////////////////
+#define CS_L hostCS(false)
+#define CS_H hostCS(true)
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Make sure pins used in the library are defined
+////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TFT_RD
+  #define TFT_RD -1
+#endif
+
+#ifndef TFT_MISO
+  #define TFT_MISO -1
+#endif
+
+#define T_CS_L // No touch controller on the host
+#define T_CS_H
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Macros to write commands/pixel colour data to the modelled display
+////////////////////////////////////////////////////////////////////////////////////////
+#define tft_Write_8(C)     hostWrite((uint8_t)(C), 1)
+#define tft_Write_16(C)    hostWrite((uint16_t)(C), 2)
+#define tft_Write_16N(C)   hostWrite((uint16_t)(C), 2)
+#define tft_Write_16S(C)   hostWrite((uint16_t)(((C)>>8) | ((C)<<8)), 2)
+#define tft_Write_32(C)    hostWrite((uint32_t)(C), 4)
+#define tft_Write_32C(C,D) hostWrite((uint32_t)((C)<<16) | (uint16_t)(D), 4)
+#define tft_Write_32D(C)   hostWrite((uint32_t)((C)<<16) | (uint16_t)(C), 4)
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Macros to read from display
+////////////////////////////////////////////////////////////////////////////////////////
+#define tft_Read_8() hostRead8()
+
+#endif // Header end
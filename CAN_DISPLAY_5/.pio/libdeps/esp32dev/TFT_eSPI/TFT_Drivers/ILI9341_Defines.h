@@ -53,6 +53,9 @@
 #define TFT_RAMRD   0x2E
 #define TFT_IDXRD   0xDD // ILI9341 only, indexed control register read
 
+#define TFT_VSCRDEF  0x33 // Vertical scrolling definition, used by setScrollArea()
+#define TFT_VSCRSADD 0x37 // Vertical scrolling start address, used by scrollTo()
+
 #define TFT_MADCTL  0x36
 #define TFT_MAD_MY  0x80
 #define TFT_MAD_MX  0x40
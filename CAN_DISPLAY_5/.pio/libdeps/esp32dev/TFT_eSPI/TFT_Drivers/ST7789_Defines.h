@@ -66,6 +66,7 @@
 #define TFT_PASET   0x2B
 #define TFT_RAMWR   0x2C
 #define TFT_RAMRD   0x2E
+
 #define TFT_MADCTL  0x36
 #define TFT_COLMOD  0x3A
 
@@ -23,6 +23,7 @@
 #define TFT_RAMWR   0x2C
 #define TFT_RAMRD   0x2E
 
+
 #define TFT_MADCTL  0x36
 #define TFT_MAD_MY  0x80
 #define TFT_MAD_MX  0x40
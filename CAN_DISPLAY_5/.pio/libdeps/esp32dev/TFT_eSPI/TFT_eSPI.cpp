@@ -15,7 +15,9 @@
 
 #include "TFT_eSPI.h"
 
-#if defined (ESP32)
+#if defined (HOST_FRAMEBUFFER) // Native host build, display modelled in memory
+  #include "Processors/TFT_eSPI_Host.c"
+#elif defined (ESP32)
   #if defined(CONFIG_IDF_TARGET_ESP32S3)
     #include "Processors/TFT_eSPI_ESP32_S3.c" // Tested with SPI and 8-bit parallel
   #elif defined(CONFIG_IDF_TARGET_ESP32C3)
@@ -426,8 +428,8 @@ bool TFT_eSPI::clipWindow(int32_t *xs, int32_t *ys, int32_t *xe, int32_t *ye)
   if (*xs < _vpX) *xs = _vpX;
   if (*ys < _vpY) *ys = _vpY;
 
-  if (*xe > _vpW) *xe = _vpW - 1;
-  if (*ye > _vpH) *ye = _vpH - 1;
+  if (*xe >= _vpW) *xe = _vpW - 1;
+  if (*ye >= _vpH) *ye = _vpH - 1;
 
   return true;  // Area is wholly or partially inside viewport
 }
@@ -447,6 +449,9 @@ TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
   rotation  = 0;
   cursor_y  = cursor_x  = last_cursor_x = bg_cursor_x = 0;
   textfont  = 1;
+#ifdef LOAD_GFXFF
+  gfxFont   = nullptr;  // GLCD font, sprites created with new would otherwise inherit heap garbage
+#endif
   textsize  = 1;
   textcolor   = bitmap_fg = 0xFFFF; // White
   textbgcolor = bitmap_bg = 0x0000; // Black
@@ -486,6 +491,10 @@ TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
   _xPivot = 0;
   _yPivot = 0;
 
+#if defined (SHADOW_SUPPORT)
+  _shadow = nullptr;  // No display RAM shadow until createShadow()
+#endif
+
 // Legacy support for bit GPIO masks
   cspinmask = 0;
   dcpinmask = 0;
@@ -881,6 +890,11 @@ void TFT_eSPI::setRotation(uint8_t m)
 
   // Reset the viewport to the whole screen
   resetViewport();
+
+#if defined (SHADOW_SUPPORT)
+  // The shadow layout only matches the display RAM in the rotation it was made in
+  if (_shadow && rotation != _shadowRotation) deleteShadow();
+#endif
 }
 
 
@@ -1143,6 +1157,10 @@ uint16_t TFT_eSPI::readPixel(int32_t x0, int32_t y0)
   // Range checking
   if ((x0 < _vpX) || (y0 < _vpY) ||(x0 >= _vpW) || (y0 >= _vpH)) return 0;
 
+#if defined (SHADOW_SUPPORT)
+  if (_shadow) return shadowRead(x0, y0);
+#endif
+
 #if defined(TFT_PARALLEL_8_BIT) || defined(RP2040_PIO_INTERFACE)
 
   if (!inTransaction) { CS_L; } // CS_L can be multi-statement
@@ -1274,6 +1292,20 @@ void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *da
 {
   PI_CLIP ;
 
+#if defined (SHADOW_SUPPORT)
+  if (_shadow) {
+    data += dx + dy * w;
+    for (int32_t yp = y; yp < y + dh; yp++, data += w) {
+      for (int32_t xp = 0; xp < dw; xp++) {
+        uint16_t color = shadowRead(x + xp, yp);
+        // Swapped colour byte order for compatibility with pushRect()
+        data[xp] = color << 8 | color >> 8;
+      }
+    }
+    return;
+  }
+#endif
+
 #if defined(TFT_PARALLEL_8_BIT) || defined(RP2040_PIO_INTERFACE)
 
   CS_L;
@@ -1441,6 +1473,121 @@ void TFT_eSPI::pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *da
 }
 
 
+#if defined (SHADOW_SUPPORT)
+/***************************************************************************************
+** Function name:           createShadow
+** Description:             Keep a copy of the display RAM for readPixel() and readRect()
+***************************************************************************************/
+bool TFT_eSPI::createShadow(uint8_t bits)
+{
+  if (!directWrite() || (bits != 16 && bits != 8)) return false;
+
+  deleteShadow();
+
+  uint32_t pixels = (uint32_t)_width * _height;
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+  if ( psramFound() && _psram_enable ) _shadow = ps_calloc(pixels, bits >> 3);
+  else
+#endif
+  _shadow = calloc(pixels, bits >> 3);
+  if (_shadow == nullptr) return false;
+
+  _shadowBits     = bits;
+  _shadowRotation = rotation;
+  _shadowWidth    = _width;
+  _shadowHeight   = _height;
+  shadowWindow(0, 0, -1, -1); // No window until the next setWindow()
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           deleteShadow
+** Description:             Free the display RAM shadow, reads go to the display again
+***************************************************************************************/
+void TFT_eSPI::deleteShadow(void)
+{
+  if (_shadow == nullptr) return;
+  free(_shadow);
+  _shadow = nullptr;
+}
+
+
+/***************************************************************************************
+** Function name:           shadowWindow
+** Description:             Track the display RAM window, as set by setWindow()
+***************************************************************************************/
+void TFT_eSPI::shadowWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  _shadowX0 = _shadowX = x0;
+  _shadowY0 = _shadowY = y0;
+  _shadowX1 = x1;
+  _shadowY1 = y1;
+}
+
+
+/***************************************************************************************
+** Function name:           shadowWrite
+** Description:             Copy pixels sent to the display into the shadow
+***************************************************************************************/
+// The display fills the window left to right, top to bottom and wraps to the start
+// at the end. The shadow follows it a row section at a time.
+void TFT_eSPI::shadowWrite(const uint16_t *data, uint16_t color, uint32_t len, bool swap)
+{
+  if (_shadowX1 < _shadowX0 || _shadowY1 < _shadowY0) return;
+
+  while (len) {
+    uint32_t n = _shadowX1 - _shadowX + 1;
+    if (n > len) n = len;
+
+    // Part of the row section inside the shadow
+    int32_t xs = _shadowX, xe = _shadowX + n;
+    if (xs < 0) xs = 0;
+    if (xe > _shadowWidth) xe = _shadowWidth;
+    if (_shadowY >= 0 && _shadowY < _shadowHeight && xs < xe) {
+      const uint16_t *src = data ? data + (xs - _shadowX) : nullptr;
+      uint32_t i = xs + _shadowY * _shadowWidth;
+      uint32_t e = xe + _shadowY * _shadowWidth;
+      if (_shadowBits == 16) {
+        uint16_t *dst = (uint16_t*)_shadow;
+        if (!src) while (i < e) dst[i++] = color;
+        else if (swap) while (i < e) { dst[i++] = *src << 8 | *src >> 8; src++; }
+        else while (i < e) dst[i++] = *src++;
+      }
+      else {
+        uint8_t *dst = (uint8_t*)_shadow;
+        if (!src) { uint8_t c = color16to8(color); while (i < e) dst[i++] = c; }
+        else if (swap) while (i < e) { dst[i++] = color16to8(*src << 8 | *src >> 8); src++; }
+        else while (i < e) dst[i++] = color16to8(*src++);
+      }
+    }
+
+    if (data) data += n;
+    len -= n;
+    _shadowX += n;
+    if (_shadowX > _shadowX1) {
+      _shadowX = _shadowX0;
+      if (++_shadowY > _shadowY1) _shadowY = _shadowY0;
+    }
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           shadowRead
+** Description:             Colour of a pixel in the shadow, 0 outside of it
+***************************************************************************************/
+uint16_t TFT_eSPI::shadowRead(int32_t x, int32_t y)
+{
+  if (x < 0 || y < 0 || x >= _shadowWidth || y >= _shadowHeight) return 0;
+  uint32_t i = x + y * _shadowWidth;
+  if (_shadowBits == 16) return ((uint16_t*)_shadow)[i];
+  return color8to16(((uint8_t*)_shadow)[i]);
+}
+#endif
+
+
 /***************************************************************************************
 ** Function name:           pushImage
 ** Description:             plot 16-bit colour sprite or image onto TFT
@@ -3204,7 +3351,7 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
   if (!_cp437 && c > 175) c++;
 
   bool fillbg = (bg != color);
-  bool clip = xd < _vpX || xd + 6  * textsize >= _vpW || yd < _vpY || yd + 8 * textsize >= _vpH;
+  bool clip = xd < _vpX || xd + 6  * size >= _vpW || yd < _vpY || yd + 8 * size >= _vpH;
 
   if ((size==1) && fillbg && !clip) {
     uint8_t column[6];
@@ -3218,11 +3365,41 @@ void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32
 
     for (int8_t j = 0; j < 8; j++) {
       for (int8_t k = 0; k < 5; k++ ) {
-        if (column[k] & mask) {tft_Write_16(color);}
-        else {tft_Write_16(bg);}
+        if (column[k] & mask) {tft_Write_16(color); SHADOW_BLOCK(color, 1);}
+        else {tft_Write_16(bg); SHADOW_BLOCK(bg, 1);}
       }
       mask <<= 1;
       tft_Write_16(bg);
+      SHADOW_BLOCK(bg, 1);
+    }
+
+    end_tft_write();
+  }
+  else if ((size <= GLCD_MAX_SCALE) && fillbg && !clip) {
+    // Scaled character in one window, each font row is expanded once into a
+    // line buffer then pushed size times
+    uint16_t lineBuf[6 * GLCD_MAX_SCALE];
+    uint8_t  column[5];
+    uint16_t w = 6 * size;
+
+    // pushPixels() sends the buffer as stored unless swapping is enabled
+    uint16_t fg = _swapBytes ? color : (uint16_t)(color >> 8 | color << 8);
+    uint16_t bk = _swapBytes ? bg    : (uint16_t)(bg    >> 8 | bg    << 8);
+
+    for (int8_t i = 0; i < 5; i++ ) column[i] = pgm_read_byte(&font[0] + (c * 5) + i);
+    for (uint16_t i = 5 * size; i < w; i++) lineBuf[i] = bk;
+
+    begin_tft_write();
+
+    setWindow(xd, yd, xd + w - 1, yd + 8 * size - 1);
+
+    for (uint8_t mask = 0x1; mask; mask <<= 1) {
+      uint16_t* p = lineBuf;
+      for (int8_t k = 0; k < 5; k++ ) {
+        uint16_t pc = (column[k] & mask) ? fg : bk;
+        for (uint8_t n = 0; n < size; n++) *p++ = pc;
+      }
+      for (uint8_t n = 0; n < size; n++) pushPixels(lineBuf, w);
     }
 
     end_tft_write();
@@ -3363,6 +3540,8 @@ void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
   addr_row = 0xFFFF;
   addr_col = 0xFFFF;
 
+  SHADOW_WINDOW(x0, y0, x1, y1);
+
 #if defined (ILI9225_DRIVER)
   if (rotation & 0x01) { transpose(x0, y0); transpose(x1, y1); }
   SPI_BUSY_CHECK;
@@ -3504,6 +3683,8 @@ void TFT_eSPI::readAddrWindow(int32_t xs, int32_t ys, int32_t w, int32_t h)
   int32_t xe = xs + w - 1;
   int32_t ye = ys + h - 1;
 
+  SHADOW_WINDOW(xs, ys, xe, ye); // The display writes to the read window after a read
+
   addr_col = 0xFFFF;
   addr_row = 0xFFFF;
 
@@ -3589,6 +3770,9 @@ void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
   // Range checking
   if ((x < _vpX) || (y < _vpY) ||(x >= _vpW) || (y >= _vpH)) return;
 
+  SHADOW_WINDOW(x, y, x, y);
+  SHADOW_BLOCK(color, 1);
+
 #ifdef CGRAM_OFFSET
   x+=colstart;
   y+=rowstart;
@@ -3793,6 +3977,7 @@ void TFT_eSPI::pushColor(uint16_t color)
 
   SPI_BUSY_CHECK;
   tft_Write_16N(color);
+  SHADOW_BLOCK(color, 1);
 
   end_tft_write();
 }
@@ -4082,8 +4267,10 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
   }
   inTransaction = true;
 
+  // Rows of a quadrant for these radii, nullptr if there is no memory for them
+  const arcQuadrant* arc = arcProfile(r, ir, smooth);
+
   int32_t xs = 0;        // x start position for quadrant scan
-  uint8_t alpha = 0;     // alpha value for blending pixels
 
   uint32_t r2 = r * r;   // Outer arc radius^2
   if (smooth) r++;       // Outer AA zone radius
@@ -4151,72 +4338,53 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
     endSlope[3] =  slope;
   }
 
+  // Slope range of each quadrant, slopes are compared as for the BL, TL, TR and BR pixels
+  uint32_t loSlope[4] = {   endSlope[0], startSlope[1],   endSlope[2], startSlope[3] };
+  uint32_t hiSlope[4] = { startSlope[0],   endSlope[1], startSlope[2],   endSlope[3] };
+
+  // Arc inside the viewport is written one address window per quadrant row section
+  int32_t xd = x + _xDatum;
+  int32_t yd = y + _yDatum;
+  bool direct = directWrite() && xd - r >= _vpX && xd + r < _vpW && yd - r >= _vpY && yd + r < _vpH;
+  if (direct) begin_tft_write();
+
+  arcRow  scanRow;
+  uint8_t scanAlpha[arc ? 1 : r];
+
   // Scan quadrant
   for (int32_t cy = r - 1; cy > 0; cy--)
   {
-    uint32_t len[4] = { 0,  0,  0,  0}; // Pixel run length
-    int32_t  xst[4] = {-1, -1, -1, -1}; // Pixel run x start
-    uint32_t dy2 = (r - cy) * (r - cy);
+    const arcRow*  row   = &scanRow;
+    const uint8_t* alpha = scanAlpha;
 
-    // Find and track arc zone start point
-    while ((r - xs) * (r - xs) + dy2 >= r1) xs++;
+    if (arc) {
+      row   = arc->row + (r - 1 - cy);
+      alpha = arc->alpha + row->aa;
+    }
+    else arcRowScan(r, cy, &xs, r1, r2, r3, r4, &scanRow, scanAlpha);
 
-    for (int32_t cx = xs; cx < r; cx++)
+    // Pixel slope ((r - cy) << 16) / (r - cx) rises with cx, so the pixels between
+    // the start and end slopes of a quadrant are a run of cx from c0 to c1
+    uint32_t dy = (r - cy) << 16;
+    for (uint8_t q = 0; q < 4; q++)
     {
-      // Calculate radius^2
-      uint32_t hyp = (r - cx) * (r - cx) + dy2;
-
-      // If in outer zone calculate alpha
-      if (hyp > r2) {
-        alpha = ~sqrt_fraction(hyp); // Outer AA zone
-      }
-      // If within arc fill zone, get line start and lengths for each quadrant
-      else if (hyp >= r3) {
-        // Calculate U16.16 slope
-        slope = ((r - cy) << 16)/(r - cx);
-        if (slope <= startSlope[0] && slope >= endSlope[0]) { // slope hi -> lo
-          xst[0] = cx; // Bottom left line end
-          len[0]++;
-        }
-        if (slope >= startSlope[1] && slope <= endSlope[1]) { // slope lo -> hi
-          xst[1] = cx; // Top left line end
-          len[1]++;
-        }
-        if (slope <= startSlope[2] && slope >= endSlope[2]) { // slope hi -> lo
-          xst[2] = cx; // Bottom right line start
-          len[2]++;
-        }
-        if (slope <= endSlope[3] && slope >= startSlope[3]) { // slope lo -> hi
-          xst[3] = cx; // Top right line start
-          len[3]++;
-        }
-        continue; // Next x
+      if (loSlope[q] > hiSlope[q]) continue;
+      int32_t c0 = row->xs;
+      int32_t c1 = row->ie - 1;
+      if (loSlope[q]) { // slope >= lo when r - cx <= dy / lo
+        uint32_t dx = dy / loSlope[q];
+        if ((int32_t)dx < r - c0) c0 = r - dx;
       }
-      else {
-        if (hyp <= r4) break;  // Skip inner pixels
-        alpha = sqrt_fraction(hyp); // Inner AA zone
-      }
-
-      if (alpha < 16) continue;  // Skip low alpha pixels
-
-      // If background is read it must be done in each quadrant
-      uint16_t pcol = fastBlend(alpha, fg_color, bg_color);
-      // Check if an AA pixels need to be drawn
-      slope = ((r - cy)<<16)/(r - cx);
-      if (slope <= startSlope[0] && slope >= endSlope[0]) // BL
-        drawPixel(x + cx - r, y - cy + r, pcol);
-      if (slope >= startSlope[1] && slope <= endSlope[1]) // TL
-        drawPixel(x + cx - r, y + cy - r, pcol);
-      if (slope <= startSlope[2] && slope >= endSlope[2]) // TR
-        drawPixel(x - cx + r, y + cy - r, pcol);
-      if (slope <= endSlope[3] && slope >= startSlope[3]) // BR
-        drawPixel(x - cx + r, y - cy + r, pcol);
+      // slope <= hi when r - cx > dy / (hi + 1)
+      uint32_t dx = dy / ((uint64_t)hiSlope[q] + 1);
+      if ((int32_t)dx >= r - c1) c1 = r - 1 - dx;
+      if (c0 > c1) continue;
+
+      if (q == 0) drawArcRow(x + c0 - r, y - cy + r, c0, c1,  1, row, alpha, fg_color, bg_color, direct); // BL
+      if (q == 1) drawArcRow(x + c0 - r, y + cy - r, c0, c1,  1, row, alpha, fg_color, bg_color, direct); // TL
+      if (q == 2) drawArcRow(x - c1 + r, y + cy - r, c1, c0, -1, row, alpha, fg_color, bg_color, direct); // TR
+      if (q == 3) drawArcRow(x - c1 + r, y - cy + r, c1, c0, -1, row, alpha, fg_color, bg_color, direct); // BR
     }
-    // Add line in inner zone
-    if (len[0]) drawFastHLine(x + xst[0] - len[0] + 1 - r, y - cy + r, len[0], fg_color); // BL
-    if (len[1]) drawFastHLine(x + xst[1] - len[1] + 1 - r, y + cy - r, len[1], fg_color); // TL
-    if (len[2]) drawFastHLine(x - xst[2] + r, y + cy - r, len[2], fg_color); // TR
-    if (len[3]) drawFastHLine(x - xst[3] + r, y - cy + r, len[3], fg_color); // BR
   }
 
   // Fill in centre lines
@@ -4229,6 +4397,167 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
   end_tft_write();
 }
 
+/***************************************************************************************
+** Function name:           updateArc
+** Description:             Draw the change in length of an arc drawn from startAngle
+***************************************************************************************/
+// The arc between the old and new end is drawn in fg_color if the arc grew, or in the
+// track_color of the unfilled part if it shrank. Arc ends are not anti-aliased, so the
+// segments join cleanly as for drawArc()
+void TFT_eSPI::updateArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t oldEnd, uint32_t newEnd, uint32_t fg_color, uint32_t track_color, uint32_t bg_color, bool smoothArc)
+{
+  if (startAngle > 360) startAngle = 360;
+  if (oldEnd     > 360)     oldEnd = 360;
+  if (newEnd     > 360)     newEnd = 360;
+  if (oldEnd == newEnd) return;
+
+  // Clockwise sweep of each end from the start
+  uint32_t oldSweep = (oldEnd >= startAngle) ? oldEnd - startAngle : oldEnd + 360 - startAngle;
+  uint32_t newSweep = (newEnd >= startAngle) ? newEnd - startAngle : newEnd + 360 - startAngle;
+
+  if (newSweep > oldSweep) drawArc(x, y, r, ir, oldEnd, newEnd, fg_color, bg_color, smoothArc);
+  else drawArc(x, y, r, ir, newEnd, oldEnd, track_color, bg_color, smoothArc);
+}
+
+/***************************************************************************************
+** Function name:           arcProfile (private function)
+** Description:             Get the rows of an arc quadrant, built on a change of radii
+***************************************************************************************/
+TFT_eSPI::arcQuadrant* TFT_eSPI::arcCache = nullptr;
+
+const TFT_eSPI::arcQuadrant* TFT_eSPI::arcProfile(int32_t r, int32_t ir, bool smooth)
+{
+  if (arcCache && arcCache->r == r && arcCache->ir == ir && arcCache->smooth == smooth) return arcCache;
+
+  if (arcCache) {
+    free(arcCache);
+    arcCache = nullptr;
+  }
+
+  // Zone radii as in drawArc()
+  int32_t ar = r;
+  int32_t air = ir;
+  uint32_t r2 = ar * ar;
+  if (smooth) ar++;
+  uint32_t r1 = ar * ar;
+  uint32_t r3 = air * air;
+  if (smooth) air--;
+  uint32_t r4 = air * air;
+
+  // Count the alpha values, then scan again to fill in the rows
+  uint32_t count = 0;
+  int32_t  xs = 0;
+  arcRow   row;
+  for (int32_t cy = ar - 1; cy > 0; cy--) count += arcRowScan(ar, cy, &xs, r1, r2, r3, r4, &row, nullptr);
+
+  uint32_t rows = ar - 1;
+  arcQuadrant* arc = (arcQuadrant*)malloc(sizeof(arcQuadrant) + rows * sizeof(arcRow) + count);
+  if (!arc) return nullptr;
+
+  arc->r      = r;
+  arc->ir     = ir;
+  arc->smooth = smooth;
+  arc->row    = (arcRow*)(arc + 1);
+  arc->alpha  = (uint8_t*)(arc->row + rows);
+
+  count = 0;
+  xs = 0;
+  for (uint32_t i = 0; i < rows; i++) {
+    arc->row[i].aa = count;
+    count += arcRowScan(ar, ar - 1 - i, &xs, r1, r2, r3, r4, arc->row + i, arc->alpha + count);
+  }
+
+  arcCache = arc;
+  return arc;
+}
+
+/***************************************************************************************
+** Function name:           arcRowScan (private function)
+** Description:             Find the zones and edge alpha values of an arc quadrant row
+***************************************************************************************/
+// r, r1-r4 and the tracked zone start xs are as in drawArc(). Returns the number of
+// alpha values, which are only written if alpha is not nullptr
+uint32_t TFT_eSPI::arcRowScan(int32_t r, int32_t cy, int32_t *xs, uint32_t r1, uint32_t r2, uint32_t r3, uint32_t r4, arcRow *row, uint8_t *alpha)
+{
+  uint32_t dy2 = (r - cy) * (r - cy);
+  uint32_t n = 0;
+  int32_t  cx;
+
+  // Find and track arc zone start point
+  while ((r - *xs) * (r - *xs) + dy2 >= r1) (*xs)++;
+
+  // Outer AA zone
+  for (cx = *xs; cx < r; cx++) {
+    uint32_t hyp = (r - cx) * (r - cx) + dy2;
+    if (hyp <= r2) break;
+    if (alpha) alpha[n] = ~sqrt_fraction(hyp);
+    n++;
+  }
+  row->xs = *xs;
+  row->fs = cx;
+
+  // Arc fill zone
+  for (; cx < r; cx++) {
+    if ((r - cx) * (r - cx) + dy2 < r3) break;
+  }
+  row->fe = cx;
+
+  // Inner AA zone
+  for (; cx < r; cx++) {
+    uint32_t hyp = (r - cx) * (r - cx) + dy2;
+    if (hyp <= r4) break;  // Skip inner pixels
+    if (alpha) alpha[n] = sqrt_fraction(hyp);
+    n++;
+  }
+  row->ie = cx;
+
+  return n;
+}
+
+/***************************************************************************************
+** Function name:           drawArcRow (private function)
+** Description:             Draw the pixels of a quadrant row from c0 to c1
+***************************************************************************************/
+// px, py is the screen position of c0, step is -1 for the right hand quadrants so the
+// pixels are always drawn left to right. The fill zone is a solid run, AA pixels with an
+// alpha < 16 are skipped. If direct, each section between skipped pixels is one window
+void TFT_eSPI::drawArcRow(int32_t px, int32_t py, int32_t c0, int32_t c1, int32_t step, const arcRow *row, const uint8_t *alpha, uint32_t fg_color, uint32_t bg_color, bool direct)
+{
+  int32_t n = (c1 - c0) * step + 1;
+  bool open = false; // Window is set at pixel i
+
+  for (int32_t i = 0, cx = c0; i < n; )
+  {
+    if (cx >= row->fs && cx < row->fe)
+    {
+      int32_t len = (step > 0) ? ((c1 < row->fe - 1) ? c1 : row->fe - 1) - cx + 1
+                               : cx - ((c1 > row->fs) ? c1 : row->fs) + 1;
+      if (direct) {
+        if (!open) { setWindow(px + i + _xDatum, py + _yDatum, px + n - 1 + _xDatum, py + _yDatum); open = true; }
+        pushBlock(fg_color, len);
+      }
+      else drawFastHLine(px + i, py, len, fg_color);
+      i  += len;
+      cx += len * step;
+      continue;
+    }
+
+    uint8_t a = (cx < row->fs) ? alpha[cx - row->xs] : alpha[row->fs - row->xs + cx - row->fe];
+    if (a < 16) open = false; // Skip low alpha pixels
+    else {
+      uint16_t pcol = fastBlend(a, fg_color, bg_color);
+      if (direct) {
+        if (!open) { setWindow(px + i + _xDatum, py + _yDatum, px + n - 1 + _xDatum, py + _yDatum); open = true; }
+        tft_Write_16(pcol);
+        SHADOW_BLOCK(pcol, 1);
+      }
+      else drawPixel(px + i, py, pcol);
+    }
+    i++;
+    cx += step;
+  }
+}
+
 /***************************************************************************************
 ** Function name:           drawSmoothCircle
 ** Description:             Draw a smooth circle
@@ -4486,92 +4815,114 @@ void TFT_eSPI::drawWedgeLine(float ax, float ay, float bx, float by, float ar, f
 
   if (!clipWindow(&x0, &y0, &x1, &y1)) return;
 
-  // Establish x start and y start
-  int32_t ys = ay;
-  if ((ax-ar)>(bx-br)) ys = by;
+  // Work in screen coordinates, clipWindow() has added the viewport datum to the box
+  ax += _xDatum; bx += _xDatum;
+  ay += _yDatum; by += _yDatum;
 
   float rdt = ar - br; // Radius delta
-  float alpha = 1.0f;
   ar += 0.5;
 
+  float bax = bx - ax, bay = by - ay;
+  float len2 = bax * bax + bay * bay;
+
+  bool direct = directWrite();
+  bool readBG = (bg_color == 0x00FFFFFF);
   uint16_t bg = bg_color;
-  float xpax, ypay, bax = bx - ax, bay = by - ay;
+  uint8_t  aa[x1 - x0 + 1];             // Edge pixel alpha, 0 to skip, 255 for fg_color
+  uint16_t line[readBG ? x1 - x0 + 1 : 1]; // Edge pixel background
 
-  begin_nin_write();
+  if (direct) begin_nin_write();
   inTransaction = true;
+#ifdef GC9A01_DRIVER
+  direct = false; // Pixels and runs are drawn individually on this controller, not in row windows
+#endif
 
-  int32_t xs = x0;
-  // Scan bounding box from ys down, calculate pixel intensity from distance to line
-  for (int32_t yp = ys; yp <= y1; yp++) {
-    bool swin = true;  // Flag to start new window area
-    bool endX = false; // Flag to skip pixels
-    ypay = yp - ay;
-    for (int32_t xp = xs; xp <= x1; xp++) {
-      if (endX) if (alpha <= LoAlphaTheshold) break;  // Skip right side
-      xpax = xp - ax;
-      alpha = ar - wedgeLineDistance(xpax, ypay, bax, bay, rdt);
-      if (alpha <= LoAlphaTheshold ) continue;
-      // Track edge to minimise calculations
-      if (!endX) { endX = true; xs = xp; }
-      if (alpha > HiAlphaTheshold) {
-        #ifdef GC9A01_DRIVER
-          drawPixel(xp, yp, fg_color);
-        #else
-          if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-          pushColor(fg_color);
-        #endif
-        continue;
+  for (int32_t yp = y0; yp <= y1; yp++) {
+    float ypay = yp - ay;
+    float lo, hi;
+
+    // Pixels with alpha > LoAlphaTheshold, the span maths is float so check the ends
+    if (!wedgeLineSpan(ypay, ar - LoAlphaTheshold, bax, bay, rdt, &lo, &hi)) continue;
+    int32_t xl = (lo + ax < x0) ? x0 : (int32_t)floorf(lo + ax) + 1;
+    int32_t xr = (hi + ax > x1) ? x1 : (int32_t) ceilf(hi + ax) - 1;
+    while (xl > x0 && ar - wedgeLineDistance(xl - 1 - ax, ypay, bax, bay, rdt) > LoAlphaTheshold) xl--;
+    while (xl <= xr && ar - wedgeLineDistance(xl - ax, ypay, bax, bay, rdt) <= LoAlphaTheshold) xl++;
+    while (xr < x1 && ar - wedgeLineDistance(xr + 1 - ax, ypay, bax, bay, rdt) > LoAlphaTheshold) xr++;
+    while (xr >= xl && ar - wedgeLineDistance(xr - ax, ypay, bax, bay, rdt) <= LoAlphaTheshold) xr--;
+    if (xl > xr) continue;
+
+    // Solid run of pixels with alpha > HiAlphaTheshold, empty if sl > sr
+    int32_t sl = xr + 1, sr = xr;
+    if (wedgeLineSpan(ypay, ar - HiAlphaTheshold, bax, bay, rdt, &lo, &hi)) {
+      sl = (lo + ax < xl) ? xl : (int32_t)floorf(lo + ax) + 1;
+      sr = (hi + ax > xr) ? xr : (int32_t) ceilf(hi + ax) - 1;
+      while (sl > xl && ar - wedgeLineDistance(sl - 1 - ax, ypay, bax, bay, rdt) > HiAlphaTheshold) sl--;
+      while (sl <= sr && ar - wedgeLineDistance(sl - ax, ypay, bax, bay, rdt) <= HiAlphaTheshold) sl++;
+      while (sr < xr && ar - wedgeLineDistance(sr + 1 - ax, ypay, bax, bay, rdt) > HiAlphaTheshold) sr++;
+      while (sr >= sl && ar - wedgeLineDistance(sr - ax, ypay, bax, bay, rdt) <= HiAlphaTheshold) sr--;
+      if (sl > sr) { sl = xr + 1; sr = xr; }
+    }
+
+    // Distance is convex along the row either side of where it crosses the lines through
+    // a and b at right angles to the wedge, so the spans are gap free if the pixels each
+    // side of a crossing are in them. If not (one end radius much larger than the other)
+    // every pixel of the row is checked.
+    if (bax != 0.0f) {
+      float xc[2] = { ax - ypay * bay / bax, ax + (len2 - ypay * bay) / bax };
+      for (uint8_t i = 0; i < 2; i++) {
+        if (!(xc[i] > xl && xc[i] <= xr)) continue;
+        int32_t xp = (int32_t)ceilf(xc[i]) - 1; // Last pixel before the crossing
+        float t = (xp >= sl && xp < sr) ? HiAlphaTheshold : LoAlphaTheshold;
+        if (ar - wedgeLineDistance(xp - ax, ypay, bax, bay, rdt) <= t ||
+            ar - wedgeLineDistance(xp + 1 - ax, ypay, bax, bay, rdt) <= t) { sl = xr + 1; sr = xr; }
       }
-      //Blend color with background and plot
-      if (bg_color == 0x00FFFFFF) {
-        bg = readPixel(xp, yp); swin = true;
+    }
+
+    // Only the edge pixels either side of the solid run need the distance to the line
+    for (int32_t xp = xl; xp <= xr; xp++) {
+      if (xp == sl) { xp = sr; continue; }
+      float alpha = ar - wedgeLineDistance(xp - ax, ypay, bax, bay, rdt);
+      if (alpha <= LoAlphaTheshold) aa[xp - xl] = 0;
+      else if (alpha > HiAlphaTheshold) aa[xp - xl] = 255;
+      else aa[xp - xl] = (uint8_t)(alpha * PixelAlphaGain);
+    }
+
+    // Read the background before the row window is opened, one read per edge
+    if (readBG) {
+      for (int32_t xs = xl, xe = sl; xs <= xr; xs = sr + 1, xe = xr + 1) {
+        if (xe > xs) {
+          if (direct) {
+            readRect(xs - _xDatum, yp - _yDatum, xe - xs, 1, line + xs - xl);
+            for (int32_t i = xs - xl; i < xe - xl; i++) line[i] = line[i] << 8 | line[i] >> 8;
+          }
+          else for (int32_t i = xs; i < xe; i++) line[i - xl] = readPixel(i - _xDatum, yp - _yDatum);
+        }
+        if (xe == xr + 1) break;
       }
-      #ifdef GC9A01_DRIVER
-        uint16_t pcol = fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg);
-        drawPixel(xp, yp, pcol);
-        swin = swin;
-      #else
-        if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-        pushColor(fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
-      #endif
     }
-  }
 
-  // Reset x start to left side of box
-  xs = x0;
-  // Scan bounding box from ys-1 up, calculate pixel intensity from distance to line
-  for (int32_t yp = ys-1; yp >= y0; yp--) {
-    bool swin = true;  // Flag to start new window area
-    bool endX = false; // Flag to skip pixels
-    ypay = yp - ay;
-    for (int32_t xp = xs; xp <= x1; xp++) {
-      if (endX) if (alpha <= LoAlphaTheshold) break;  // Skip right side of drawn line
-      xpax = xp - ax;
-      alpha = ar - wedgeLineDistance(xpax, ypay, bax, bay, rdt);
-      if (alpha <= LoAlphaTheshold ) continue;
-      // Track line boundary
-      if (!endX) { endX = true; xs = xp; }
-      if (alpha > HiAlphaTheshold) {
-        #ifdef GC9A01_DRIVER
-          drawPixel(xp, yp, fg_color);
-        #else
-          if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-          pushColor(fg_color);
-        #endif
+    // Row is one window with a block write for the solid run, unless edge pixels are skipped
+    bool open = false;
+    for (int32_t xp = xl; xp <= xr; xp++) {
+      if (xp == sl) {
+        if (direct) {
+          if (!open) { setWindow(xp, yp, xr, yp); open = true; }
+          pushBlock(fg_color, sr - sl + 1);
+        }
+        else drawFastHLine(xp - _xDatum, yp - _yDatum, sr - sl + 1, fg_color);
+        xp = sr;
         continue;
       }
-      //Blend colour with background and plot
-      if (bg_color == 0x00FFFFFF) {
-        bg = readPixel(xp, yp); swin = true;
+      uint8_t a = aa[xp - xl];
+      if (!a) { open = false; continue; }
+      if (readBG) bg = line[xp - xl];
+      uint16_t pcol = (a == 255) ? (uint16_t)fg_color : fastBlend(a, fg_color, bg);
+      if (direct) {
+        if (!open) { setWindow(xp, yp, xr, yp); open = true; }
+        tft_Write_16(pcol);
+        SHADOW_BLOCK(pcol, 1);
       }
-      #ifdef GC9A01_DRIVER
-        uint16_t pcol = fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg);
-        drawPixel(xp, yp, pcol);
-        swin = swin;
-      #else
-        if (swin) { setWindow(xp, yp, x1, yp); swin = false; }
-        pushColor(fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
-      #endif
+      else drawPixel(xp - _xDatum, yp - _yDatum, pcol);
     }
   }
 
@@ -4592,6 +4943,61 @@ inline float TFT_eSPI::wedgeLineDistance(float xpax, float ypay, float bax, floa
 }
 
 
+/***************************************************************************************
+** Function name:           wedgeLineSpan - private helper function for drawWedgeLine
+** Description:             find the x range of a row where wedgeLineDistance() < k
+***************************************************************************************/
+// The wedge is a disc of radius k at a, a band along a to b and a disc of radius k - dr
+// at b, each limited to its side of the ends. Each part crosses the row in one span, the
+// result is the span lo < px - ax < hi that covers them. Returns false if the row misses.
+bool TFT_eSPI::wedgeLineSpan(float ypay, float k, float bax, float bay, float dr, float *lo, float *hi)
+{
+  constexpr float none = 1.0e30f;
+  float ll = none, hh = -none;
+  float len2 = bax * bax + bay * bay;
+  float len  = sqrtf(len2);
+
+  // a * px < b limits the span l to h, the px - ax coordinate
+  #define WEDGE_LIMIT(A, B) { float a_ = (A), b_ = (B); \
+    if (a_ > 0.0f) { if (b_ / a_ < h) h = b_ / a_; } \
+    else if (a_ < 0.0f) { if (b_ / a_ > l) l = b_ / a_; } \
+    else if (b_ <= 0.0f) h = -none; }
+
+  // Disc at a, on the far side of a from b
+  float d2 = k * k - ypay * ypay;
+  if (k > 0.0f && d2 > 0.0f) {
+    float l = -sqrtf(d2), h = -l;
+    WEDGE_LIMIT(bax, -ypay * bay);
+    if (l < h) { ll = l; hh = h; }
+  }
+
+  // Disc at b, on the far side of b from a
+  float kb = k - dr;
+  d2 = kb * kb - (ypay - bay) * (ypay - bay);
+  if (kb > 0.0f && d2 > 0.0f) {
+    float l = bax - sqrtf(d2), h = bax + sqrtf(d2);
+    WEDGE_LIMIT(-bax, ypay * bay - len2);
+    if (l < h) { if (l < ll) ll = l; if (h > hh) hh = h; }
+  }
+
+  // Band between the ends, |cross product| / len + dr * projection < k
+  float l = -none, h = none;
+  float c1 = bay / len, c0 = -ypay * bax / len;
+  float e1 = dr * bax / len2, e0 = dr * ypay * bay / len2;
+  WEDGE_LIMIT( c1 + e1, k - c0 - e0);
+  WEDGE_LIMIT(-c1 + e1, k + c0 - e0);
+  WEDGE_LIMIT(-bax, ypay * bay);
+  WEDGE_LIMIT( bax, len2 - ypay * bay);
+  if (l < h) { if (l < ll) ll = l; if (h > hh) hh = h; }
+
+  #undef WEDGE_LIMIT
+
+  *lo = ll;
+  *hi = hh;
+  return ll < hh;
+}
+
+
 /***************************************************************************************
 ** Function name:           drawFastVLine
 ** Description:             draw a vertical line
@@ -4697,72 +5103,138 @@ void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t col
 ** Function name:           fillRectVGradient
 ** Description:             draw a filled rectangle with a vertical colour gradient
 ***************************************************************************************/
-void TFT_eSPI::fillRectVGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2)
+void TFT_eSPI::fillRectVGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2, bool dither)
 {
-  if (_vpOoB) return;
-
-  x+= _xDatum;
-  y+= _yDatum;
+  fillRectGradient(x, y, w, h, color1, color2, 0, dither);
+}
 
-  // Clipping
-  if ((x >= _vpW) || (y >= _vpH)) return;
 
-  if (x < _vpX) { w += x - _vpX; x = _vpX; }
-  if (y < _vpY) { h += y - _vpY; y = _vpY; }
+/***************************************************************************************
+** Function name:           fillRectHGradient
+** Description:             draw a filled rectangle with a horizontal colour gradient
+***************************************************************************************/
+void TFT_eSPI::fillRectHGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2, bool dither)
+{
+  fillRectGradient(x, y, w, h, color1, color2, 1, dither);
+}
 
-  if ((x + w) > _vpW) w = _vpW - x;
-  if ((y + h) > _vpH) h = _vpH - y;
 
-  if ((w < 1) || (h < 1)) return;
+/***************************************************************************************
+** Function name:           fillRectDGradient
+** Description:             draw a filled rectangle with a diagonal colour gradient
+***************************************************************************************/
+void TFT_eSPI::fillRectDGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2, bool dither)
+{
+  fillRectGradient(x, y, w, h, color1, color2, 2, dither);
+}
 
-  begin_nin_write();
 
-  float delta = -255.0/h;
-  float alpha = 255.0;
-  uint32_t color = color1;
+/***************************************************************************************
+** Function name:           fillRectGradient - private helper for the gradient fills
+** Description:             fill a rectangle from a colour ramp in one window
+***************************************************************************************/
+// The ramp has an entry per row (dir 0), column (dir 1) or diagonal x + y (dir 2), from
+// color1 to color2 over the whole rectangle so a clipped fill matches the unclipped one.
+// Entries hold the 5-6-5 channels with 4 fraction bits, red in bits 19-27, green in 9-18
+// and blue in 0-8, so one add rounds or dithers all three channels.
+#define GRADIENT_ONE 0x00080201
 
-  while (h--) {
-    drawFastHLine(x, y++, w, color);
-    alpha += delta;
-    color = fastBlend((uint8_t)alpha, color1, color2);
-  }
+// 4x4 ordered dither thresholds in 1/16ths, indexed by y & 3 then x & 3. The coordinates
+// are relative to the viewport datum so a viewport offset does not move the pattern
+static const uint8_t gradientDither[16] = { 0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5 };
 
-  end_nin_write();
+static inline uint16_t gradientColor(uint32_t f)
+{
+  return (f >> 12 & 0xF800) | (f >> 8 & 0x07E0) | (f >> 4 & 0x001F);
 }
 
-
-/***************************************************************************************
-** Function name:           fillRectHGradient
-** Description:             draw a filled rectangle with a horizontal colour gradient
-***************************************************************************************/
-void TFT_eSPI::fillRectHGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2)
+void TFT_eSPI::fillRectGradient(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color1, uint16_t color2, uint8_t dir, bool dither)
 {
   if (_vpOoB) return;
 
   x+= _xDatum;
   y+= _yDatum;
 
-  // Clipping
+  // Ramp length for the whole rectangle
+  int32_t n = (dir == 0) ? h : (dir == 1) ? w : w + h - 1;
+
+  // Clipping, ox and oy are the columns and rows clipped off the left and top
   if ((x >= _vpW) || (y >= _vpH)) return;
 
-  if (x < _vpX) { w += x - _vpX; x = _vpX; }
-  if (y < _vpY) { h += y - _vpY; y = _vpY; }
+  int32_t ox = 0, oy = 0;
+  if (x < _vpX) { ox = _vpX - x; w -= ox; x = _vpX; }
+  if (y < _vpY) { oy = _vpY - y; h -= oy; y = _vpY; }
 
   if ((x + w) > _vpW) w = _vpW - x;
   if ((y + h) > _vpH) h = _vpH - y;
 
   if ((w < 1) || (h < 1)) return;
 
+  // Only the visible part of the ramp is made, starting at entry i0
+  int32_t i0  = (dir == 0) ? oy : (dir == 1) ? ox : ox + oy;
+  int32_t len = (dir == 0) ? h  : (dir == 1) ? w  : w + h - 1;
+
+  int32_t d = (n > 1) ? n - 1 : 1;
+  int32_t c[3] = { color1 >> 11, color1 >> 5 & 0x3F, color1 & 0x1F };
+  int32_t e[3] = { color2 >> 11, color2 >> 5 & 0x3F, color2 & 0x1F };
+  const uint8_t shift[3] = { 19, 9, 0 };
+
+  uint32_t ramp[dither ? len : 1];  // Dithered fill, ramp entries then each row made in line[]
+  uint16_t line[dither ? w : len];  // Otherwise the ramp as 16-bit colours
+
+  for (int32_t i = 0; i < len; i++) {
+    uint32_t f = 0;
+    // Channel value in 1/16ths rounded to nearest, the numerator is never negative
+    for (uint8_t k = 0; k < 3; k++) f |= (uint32_t)((c[k] * 32 * d + (e[k] - c[k]) * 32 * (i0 + i) + d) / (2 * d)) << shift[k];
+    if (dither) ramp[i] = f;
+    else line[i] = gradientColor(f + 8 * GRADIENT_ONE);
+  }
+
+  bool direct = directWrite();
+
+  // Without a window a horizontal ramp is one fillRect() per run of one colour
+  if (!direct && dir == 1 && !dither) {
+    for (int32_t i = 0, k; i < w; i = k) {
+      for (k = i + 1; k < w && line[k] == line[i]; k++);
+      fillRect(x + i - _xDatum, y - _yDatum, k - i, h, line[i]);
+    }
+    return;
+  }
+
   begin_nin_write();
+  if (direct) setWindow(x, y, x + w - 1, y + h - 1);
+
+  for (int32_t j = 0; j < h; j++) {
+    int32_t yp = y + j;
+    const uint16_t *row = line;
 
-  float delta = -255.0/w;
-  float alpha = 255.0;
-  uint32_t color = color1;
+    if (dither) {
+      const uint32_t *r = ramp + ((dir == 1) ? 0 : j);
+      int32_t rs = (dir == 0) ? 0 : 1;
+      const uint8_t *t = gradientDither + ((yp - _yDatum) & 3) * 4;
+      for (int32_t i = 0; i < w; i++) line[i] = gradientColor(r[i * rs] + t[(x + i - _xDatum) & 3] * GRADIENT_ONE);
+    }
+    else if (dir == 0) {
+      // Row is one colour
+      if (direct) pushBlock(line[j], w);
+      else drawFastHLine(x - _xDatum, yp - _yDatum, w, line[j]);
+      continue;
+    }
+    else if (dir == 2) row = line + j;
 
-  while (w--) {
-    drawFastVLine(x++, y, h, color);
-    alpha += delta;
-    color = fastBlend((uint8_t)alpha, color1, color2);
+    if (direct) {
+      bool swap = _swapBytes;
+      _swapBytes = true;
+      pushPixels(row, w);
+      _swapBytes = swap;
+    }
+    else {
+      // Runs of one colour
+      for (int32_t i = 0, k; i < w; i = k) {
+        for (k = i + 1; k < w && row[k] == row[i]; k++);
+        drawFastHLine(x + i - _xDatum, yp - _yDatum, k - i, row[i]);
+      }
+    }
   }
 
   end_nin_write();
@@ -4846,6 +5318,50 @@ void TFT_eSPI::invertDisplay(bool i)
 }
 
 
+/***************************************************************************************
+** Function name:           setScrollArea
+** Description:             Set the rows moved by scrollTo(), the others are fixed
+***************************************************************************************/
+// The fixed area sizes sum to _init_height, so only panels that fill the controller's
+// display RAM rows are supported, not those mapped with an offset (CGRAM_OFFSET)
+bool TFT_eSPI::setScrollArea(uint16_t top, uint16_t rows)
+{
+#if defined (TFT_VSCRDEF) && !defined (CGRAM_OFFSET)
+  if (!directWrite() || !rows || top + rows > _init_height) return false;
+
+  uint16_t bottom = _init_height - top - rows;
+  begin_tft_write();
+  writecommand(TFT_VSCRDEF);
+  writedata(top >> 8);    writedata(top);
+  writedata(rows >> 8);   writedata(rows);
+  writedata(bottom >> 8); writedata(bottom);
+  end_tft_write();
+  return true;
+#else
+  return false;
+#endif
+}
+
+/***************************************************************************************
+** Function name:           scrollTo
+** Description:             Show display RAM row line at the top of the scroll area
+***************************************************************************************/
+bool TFT_eSPI::scrollTo(uint16_t line)
+{
+#if defined (TFT_VSCRSADD) && !defined (CGRAM_OFFSET)
+  if (!directWrite() || line >= _init_height) return false;
+
+  begin_tft_write();
+  writecommand(TFT_VSCRSADD);
+  writedata(line >> 8); writedata(line);
+  end_tft_write();
+  return true;
+#else
+  return false;
+#endif
+}
+
+
 /**************************************************************************
 ** Function name:           setAttribute
 ** Description:             Sets a control parameter of an attribute
@@ -5009,6 +5525,95 @@ uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc, uint8_t
   return alphaBlend(alpha, fgc, bgc);
 }
 
+#if defined (HOST_SSE2)
+/***************************************************************************************
+** Function name:           blend8 (host SSE2 only)
+** Description:             alphaBlend() 8 pixels, a is alpha in 16-bit lanes
+*************************************************************************************x*/
+// Per channel alphaBlend() is b + ((f - b) * w >> k), which equals (b * (2^k - w) + f * w) >> k
+// and fits 16-bit lanes. Red and blue use w = alpha >> 2, k = 6, green w = alpha, k = 8.
+static inline __m128i blend8(__m128i a, __m128i f, __m128i b)
+{
+  __m128i a6  = _mm_srli_epi16(a, 2);
+  __m128i ia6 = _mm_sub_epi16(_mm_set1_epi16(64), a6);
+  __m128i ia  = _mm_sub_epi16(_mm_set1_epi16(256), a);
+  __m128i m5  = _mm_set1_epi16(0x1F);
+  __m128i m6  = _mm_set1_epi16(0x3F);
+
+  __m128i r  = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(b, 11), ia6), _mm_mullo_epi16(_mm_srli_epi16(f, 11), a6));
+  __m128i g  = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(b, 5), m6), ia),
+                             _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(f, 5), m6), a));
+  __m128i bl = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(b, m5), ia6), _mm_mullo_epi16(_mm_and_si128(f, m5), a6));
+
+  r  = _mm_slli_epi16(_mm_srli_epi16(r, 6), 11);
+  g  = _mm_slli_epi16(_mm_srli_epi16(g, 8), 5);
+  bl = _mm_srli_epi16(bl, 6);
+  return _mm_or_si128(_mm_or_si128(r, g), bl);
+}
+#endif
+
+/***************************************************************************************
+** Function name:           alphaBlendSpan
+** Description:             Blend a 16bit colour into a span, alpha per pixel
+*************************************************************************************x*/
+// The same as alphaBlend() for each pixel. fgc is split into channels once, pixels with
+// zero alpha are left as they are.
+void TFT_eSPI::alphaBlendSpan(const uint8_t *alpha, uint16_t fgc, uint16_t *bgc, uint32_t len)
+{
+#if defined (HOST_SSE2)
+  __m128i f = _mm_set1_epi16(fgc);
+  for (; len >= 8; len -= 8, alpha += 8, bgc += 8) {
+    __m128i a = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)alpha), _mm_setzero_si128());
+    __m128i b = _mm_loadu_si128((const __m128i*)bgc);
+    _mm_storeu_si128((__m128i*)bgc, blend8(a, f, b));
+  }
+#endif
+
+  uint32_t frb = fgc & 0xF81F;
+  uint32_t fxg = fgc & 0x07E0;
+
+  while (len--) {
+    uint8_t a = *alpha++;
+    if (a) {
+      uint32_t rxb = *bgc & 0xF81F;
+      rxb += (frb - rxb) * (a >> 2) >> 6;
+      uint32_t xgx = *bgc & 0x07E0;
+      xgx += (fxg - xgx) * a >> 8;
+      *bgc = (rxb & 0xF81F) | (xgx & 0x07E0);
+    }
+    bgc++;
+  }
+}
+
+/***************************************************************************************
+** Function name:           alphaBlendSpan
+** Description:             Blend a span of 16bit colours into a span, alpha per pixel
+*************************************************************************************x*/
+void TFT_eSPI::alphaBlendSpan(const uint8_t *alpha, const uint16_t *fgc, uint16_t *bgc, uint32_t len)
+{
+#if defined (HOST_SSE2)
+  for (; len >= 8; len -= 8, alpha += 8, fgc += 8, bgc += 8) {
+    __m128i a = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)alpha), _mm_setzero_si128());
+    __m128i f = _mm_loadu_si128((const __m128i*)fgc);
+    __m128i b = _mm_loadu_si128((const __m128i*)bgc);
+    _mm_storeu_si128((__m128i*)bgc, blend8(a, f, b));
+  }
+#endif
+
+  while (len--) {
+    uint8_t a = *alpha++;
+    if (a) {
+      uint32_t rxb = *bgc & 0xF81F;
+      rxb += ((*fgc & 0xF81F) - rxb) * (a >> 2) >> 6;
+      uint32_t xgx = *bgc & 0x07E0;
+      xgx += ((*fgc & 0x07E0) - xgx) * a >> 8;
+      *bgc = (rxb & 0xF81F) | (xgx & 0x07E0);
+    }
+    fgc++;
+    bgc++;
+  }
+}
+
 /***************************************************************************************
 ** Function name:           alphaBlend
 ** Description:             Blend 24bit foreground and background with optional dither
@@ -5231,7 +5836,7 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
 
   int32_t width  = 0;
   int32_t height = 0;
-  uint32_t flash_address = 0;
+  uintptr_t flash_address = 0;
   uniCode -= 32;
 
 #ifdef LOAD_FONT2
@@ -5278,33 +5883,23 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
       for (int32_t i = 0; i < height; i++) {
         if (textcolor != textbgcolor) fillRect(x, pY, width * textsize, textsize, textbgcolor);
 
-        for (int32_t k = 0; k < w; k++) {
-          line = pgm_read_byte((uint8_t *)flash_address + w * i + k);
-          if (line) {
-            if (textsize == 1) {
-              pX = x + k * 8;
-              if (line & 0x80) drawPixel(pX, pY, textcolor);
-              if (line & 0x40) drawPixel(pX + 1, pY, textcolor);
-              if (line & 0x20) drawPixel(pX + 2, pY, textcolor);
-              if (line & 0x10) drawPixel(pX + 3, pY, textcolor);
-              if (line & 0x08) drawPixel(pX + 4, pY, textcolor);
-              if (line & 0x04) drawPixel(pX + 5, pY, textcolor);
-              if (line & 0x02) drawPixel(pX + 6, pY, textcolor);
-              if (line & 0x01) drawPixel(pX + 7, pY, textcolor);
-            }
-            else {
-              pX = x + k * 8 * textsize;
-              if (line & 0x80) fillRect(pX, pY, textsize, textsize, textcolor);
-              if (line & 0x40) fillRect(pX + textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x20) fillRect(pX + 2 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x10) fillRect(pX + 3 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x08) fillRect(pX + 4 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x04) fillRect(pX + 5 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x02) fillRect(pX + 6 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x01) fillRect(pX + 7 * textsize, pY, textsize, textsize, textcolor);
-            }
+        // Adjacent set bits, across byte boundaries, are drawn as one span
+        int32_t span = 0;
+        for (int32_t k = 0; k < w * 8; k++) {
+          if ((k & 7) == 0) line = pgm_read_byte((uint8_t *)flash_address + w * i + (k >> 3));
+          if (line & (0x80 >> (k & 7))) span++;
+          else if (span) {
+            pX = x + (k - span) * textsize;
+            if (textsize == 1) drawFastHLine(pX, pY, span, textcolor);
+            else fillRect(pX, pY, span * textsize, textsize, textcolor);
+            span = 0;
           }
         }
+        if (span) {
+          pX = x + (w * 8 - span) * textsize;
+          if (textsize == 1) drawFastHLine(pX, pY, span, textcolor);
+          else fillRect(pX, pY, span * textsize, textsize, textcolor);
+        }
         pY += textsize;
       }
 
@@ -5324,13 +5919,13 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
           line = pgm_read_byte((uint8_t *) (flash_address + w * i + k) );
           mask = 0x80;
           while (mask && pX) {
-            if (line & mask) {tft_Write_16(textcolor);}
-            else {tft_Write_16(textbgcolor);}
+            if (line & mask) {tft_Write_16(textcolor); SHADOW_BLOCK(textcolor, 1);}
+            else {tft_Write_16(textbgcolor); SHADOW_BLOCK(textbgcolor, 1);}
             pX--;
             mask = mask >> 1;
           }
         }
-        if (pX) {tft_Write_16(textbgcolor);}
+        if (pX) {tft_Write_16(textbgcolor); SHADOW_BLOCK(textbgcolor, 1);}
       }
 
       end_tft_write();
@@ -5351,12 +5946,10 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
     w *= height; // Now w is total number of pixels in the character
     if (textcolor == textbgcolor && !clip) {
 
-      int32_t px = 0, py = pY; // To hold character block start and end column and row values
+      int32_t px = 0, py = 0; // Run start column and row in font pixels
       int32_t pc = 0; // Pixel count
-      uint8_t np = textsize * textsize; // Number of pixels in a drawn pixel
+      int32_t np = 0; // Span length in font pixels
 
-      uint8_t tnp = 0; // Temporary copy of np for while loop
-      uint8_t ts = textsize - 1; // Temporary copy of textsize
       // 16-bit pixel count so maximum font size is equivalent to 180x180 pixels in area
       // w is total number of pixels to plot to fill character block
       while (pc < w) {
@@ -5365,29 +5958,18 @@ int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
         if (line & 0x80) {
           line &= 0x7F;
           line++;
-          if (ts) {
-            px = xd + textsize * (pc % width); // Keep these px and py calculations outside the loop as they are slow
-            py = yd + textsize * (pc / width);
-          }
-          else {
-            px = xd + pc % width; // Keep these px and py calculations outside the loop as they are slow
-            py = yd + pc / width;
-          }
-          while (line--) { // In this case the while(line--) is faster
-            pc++; // This is faster than putting pc+=line before while()?
-            setWindow(px, py, px + ts, py + ts);
-
-            if (ts) {
-              tnp = np;
-              while (tnp--) {tft_Write_16(textcolor);}
-            }
-            else {tft_Write_16(textcolor);}
-            px += textsize;
-
-            if (px >= (xd + width * textsize)) {
-              px = xd;
-              py += textsize;
-            }
+          px = pc % width; // Keep these px and py calculations outside the loop as they are slow
+          py = pc / width;
+          pc += line;
+          // A run that wraps is split into one span (textsize high block) per row
+          while (line) {
+            np = width - px;
+            if (np > line) np = line;
+            setWindow(xd + px * textsize, yd + py * textsize, xd + (px + np) * textsize - 1, yd + (py + 1) * textsize - 1);
+            pushBlock(textcolor, np * textsize * textsize);
+            line -= np;
+            px = 0;
+            py++;
           }
         }
         else {
@@ -5602,6 +6184,7 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
 
 
   int8_t xo = 0;
+  bool fillBox = false;
 #ifdef LOAD_GFXFF
   if (freeFont && (textcolor!=textbgcolor)) {
       cheight = (glyph_ab + glyph_bb) * textsize;
@@ -5622,15 +6205,48 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
         // Add 1 pixel of padding all round
         //cheight +=2;
         //fillRect(poX+xo-1, poY - 1 - glyph_ab * textsize, cwidth+2, cheight, textbgcolor);
-        fillRect(poX+xo, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor);
+        fillBox = true; // Filled by the run renderer or below
       }
       padding -=100;
     }
 #endif
 
+  // Padding widths either side of the text, same areas as filled at the end
+  int32_t padL = 0, padR = 0;
+  if((padX>cwidth) && (textcolor!=textbgcolor)) {
+    switch(padding) {
+      case 1:
+        padR = padX - cwidth;
+        break;
+      case 2:
+        padL = padR = (padX - cwidth) >> 1;
+        break;
+      case 3:
+        padL = poX + cwidth + xo;
+        if (padL > padX) padL = padX;
+        padL -= cwidth;
+        if (padL < 0) padL = 0;
+        break;
+    }
+  }
+
   uint16_t len = strlen(string);
   uint16_t n = 0;
 
+  // Opaque text, glyphs and padding are streamed in a single window if possible
+  int32_t runX = -1;
+  bool run = (textcolor != textbgcolor);
+#ifdef SMOOTH_FONT
+  if (fontLoaded) run = false;
+#endif
+#ifdef LOAD_GFXFF
+  if (freeFont && !fillBox) run = false;
+#endif
+  if (run) runX = drawStringRun(string, poX, poY, font, xo, cwidth, padL, padR);
+
+  if (runX >= 0) sumX = runX;
+  else if (fillBox) fillRect(poX+xo, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor);
+
 #ifdef SMOOTH_FONT
   if(fontLoaded) {
     setCursor(poX, poY);
@@ -5649,7 +6265,7 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
   }
   else
 #endif
-  {
+  if (runX < 0) {
     while (n < len) {
       uint16_t uniCode = decodeUTF8((uint8_t*)string, &n, len - n);
       sumX += drawChar(uniCode, poX+sumX, poY, font);
@@ -5672,7 +6288,7 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
       sumX += poX;
     }
 #endif
-    switch(padding) {
+    if (runX < 0) switch(padding) {
       case 1:
         fillRect(padXc,poY,padX-cwidth,cheight, textbgcolor);
         break;
@@ -5723,6 +6339,226 @@ return sumX;
 }
 
 
+/***************************************************************************************
+** Function name:           drawStringRun
+** Description :            draw opaque text and padding in a single window
+***************************************************************************************/
+// x,y is the drawString() start position (the baseline for free fonts), xo is the free
+// font negative x offset, w the text width and padL/padR the padding either side of it.
+// Each window row is rendered across all glyphs into a line buffer and pushed, with DMA
+// if initDMA() has been called. Returns the summed character advance, or -1 with nothing
+// drawn if the string must be drawn by drawChar() (clipped, or a character not in the font)
+int32_t TFT_eSPI::drawStringRun(const char *string, int32_t x, int32_t y, uint8_t font, int32_t xo, int32_t w, int32_t padL, int32_t padR)
+{
+  if (_vpOoB || w < 1) return -1;
+
+  // Glyph rendering state
+  typedef struct {
+    const uint8_t *data; // GLCD columns, font 2 bitmap, RLE stream or free font bitmap
+    int16_t  ux;         // Left edge in unscaled pixels from the text start
+    uint8_t  gw, gh;     // Unscaled glyph width and height
+    int16_t  top;        // First row of the glyph in the text box
+    uint8_t  run;        // RLE pixels left in the current run
+    bool     fg;         // RLE run is foreground
+  } run_glyph;
+
+  enum { RUN_GLCD, RUN_FONT2, RUN_RLE, RUN_GFXFF };
+
+  uint8_t  type = RUN_GLCD;
+  int32_t  rows = 8;     // Unscaled text box height
+  uint8_t  ts   = textsize;
+  uint16_t len  = strlen(string);
+
+  if (font == 1) {
+#ifdef LOAD_GFXFF
+    if (gfxFont) { type = RUN_GFXFF; rows = glyph_ab + glyph_bb; }
+  #ifndef LOAD_GLCD
+    else return -1;
+  #endif
+#elif !defined (LOAD_GLCD)
+    return -1;
+#endif
+  }
+  else {
+#ifdef LOAD_FONT2
+    if (font == 2) type = RUN_FONT2;
+  #ifdef LOAD_RLE
+    else
+  #endif
+#endif
+#ifdef LOAD_RLE
+    if (font > 2 && font < 9) type = RUN_RLE;
+#endif
+    if (type == RUN_GLCD) return -1;
+    rows = pgm_read_byte( &fontdata[font].height );
+  }
+
+  // Text box, checked before the glyph array is sized so clipped text costs no stack
+  int32_t bx = x + xo - padL + _xDatum;
+  int32_t by = y + _yDatum;
+  if (type == RUN_GFXFF) by -= glyph_ab * ts;
+  int32_t bw = padL + w + padR;
+  int32_t bh = rows * ts;
+
+  if ((bx < _vpX) || (by < _vpY) || (bx + bw > _vpW) || (by + bh > _vpH)) return -1;
+
+  // Every character advances at least one pixel, so a longer string is left to drawChar()
+  // and the glyph array is bounded by the viewport width
+  if ((int32_t)len * ts > w) return -1;
+
+  run_glyph glyph[len + 1];
+  uint16_t count = 0, n = 0;
+  int32_t  adv = 0;      // Unscaled pen advance
+
+  while (n < len) {
+    uint16_t uniCode = decodeUTF8((uint8_t*)string, &n, len - n);
+    if (!uniCode) continue;
+    run_glyph& g = glyph[count];
+    g.ux  = adv;
+    g.top = 0;
+    g.gh  = rows;
+    g.run = 0;
+    g.fg  = false;
+
+#ifdef LOAD_GFXFF
+    if (type == RUN_GFXFF) {
+      if ((uniCode < pgm_read_word(&gfxFont->first)) || (uniCode > pgm_read_word(&gfxFont->last))) continue;
+      GFXglyph *gp = &(((GFXglyph *)pgm_read_dword(&gfxFont->glyph))[uniCode - pgm_read_word(&gfxFont->first)]);
+      g.data = (uint8_t *)pgm_read_dword(&gfxFont->bitmap) + pgm_read_word(&gp->bitmapOffset);
+      g.gw   = pgm_read_byte(&gp->width);
+      g.gh   = pgm_read_byte(&gp->height);
+      g.ux   = adv - xo / ts + (int8_t)pgm_read_byte(&gp->xOffset);
+      g.top  = glyph_ab + (int8_t)pgm_read_byte(&gp->yOffset);
+      adv   += pgm_read_byte(&gp->xAdvance);
+      // Glyph pixels outside the filled box are left to drawChar()
+      if (g.ux < 0 || (g.ux + g.gw) * ts > w || g.top < 0 || g.top + g.gh > rows) return -1;
+      if (g.gw && g.gh) count++;
+      continue;
+    }
+#endif
+    if (type == RUN_GLCD) {
+#ifdef LOAD_GLCD
+      if (uniCode > 255) return -1;
+      if (!_cp437 && uniCode > 175) uniCode++;
+      g.data = &::font[0] + uniCode * 5;
+      g.gw   = 6;
+#endif
+    }
+    else {
+      if ((uniCode < 32) || (uniCode > 127)) return -1;
+      uniCode -= 32;
+#ifdef LOAD_FONT2
+      if (type == RUN_FONT2) {
+        g.data = (uint8_t *)pgm_read_dword(&chrtbl_f16[uniCode]);
+        g.gw   = pgm_read_byte(widtbl_f16 + uniCode);
+      }
+#endif
+#ifdef LOAD_RLE
+      if (type == RUN_RLE) {
+        g.data = (uint8_t *)pgm_read_dword( (const void*)(pgm_read_dword( &(fontdata[font].chartbl ) ) + uniCode*sizeof(void *)) );
+        g.gw   = pgm_read_byte( (uint8_t *)pgm_read_dword( &(fontdata[font].widthtbl ) ) + uniCode );
+      }
+#endif
+    }
+    adv += g.gw;
+    count++;
+  }
+
+  // textWidth() and the characters drawn must agree, e.g. for multi-byte UTF-8 in the GLCD font
+  if (type != RUN_GFXFF && adv * ts != w) return -1;
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA) || defined (HOST_FRAMEBUFFER)
+  bool dma = DMA_Enabled;
+#else
+  bool dma = false;
+#endif
+
+  // Line buffers hold panel byte order, pushed with byte swapping off.
+  // Two are used with DMA so one can be filled while the other is sent.
+  uint16_t lineBuf[2 * bw];
+  uint16_t fg = (uint16_t)(textcolor   >> 8 | textcolor   << 8);
+  uint16_t bg = (uint16_t)(textbgcolor >> 8 | textbgcolor << 8);
+  for (int32_t i = 0; i < 2 * bw; i++) lineBuf[i] = bg;
+
+  bool swap = _swapBytes;
+  _swapBytes = false;
+
+  begin_tft_write();
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA) || defined (HOST_FRAMEBUFFER)
+  if (dma) dmaWait();
+#endif
+
+  setWindow(bx, by, bx + bw - 1, by + bh - 1);
+
+  uint16_t *buf = lineBuf;
+  for (int32_t r = 0; r < rows; r++) {
+    uint16_t *text = buf + padL;
+    if (type != RUN_RLE) for (int32_t i = 0; i < w; i++) text[i] = bg; // RLE runs cover every pixel
+
+    for (uint16_t i = 0; i < count; i++) {
+      run_glyph& g = glyph[i];
+      uint16_t *p = text + g.ux * ts;
+
+      switch (type) {
+        case RUN_GLCD: {
+          uint8_t mask = 1 << r;
+          for (uint8_t k = 0; k < 5; k++, p += ts) {
+            if (pgm_read_byte(g.data + k) & mask) for (uint8_t t = 0; t < ts; t++) p[t] = fg;
+          }
+        } break;
+        case RUN_FONT2: {
+          uint8_t wb = (g.gw + 6) / 8;
+          const uint8_t *line = g.data + wb * r;
+          for (uint8_t k = 0; k < g.gw && k < 8 * wb; k++, p += ts) {
+            if (pgm_read_byte(line + (k >> 3)) & (0x80 >> (k & 7))) for (uint8_t t = 0; t < ts; t++) p[t] = fg;
+          }
+        } break;
+        case RUN_RLE: {
+          uint8_t k = 0;
+          while (k < g.gw) {
+            if (!g.run) {
+              uint8_t line = pgm_read_byte(g.data++);
+              g.fg  = line & 0x80;
+              g.run = (line & 0x7F) + 1;
+            }
+            uint8_t np = g.run;
+            if (np > g.gw - k) np = g.gw - k;
+            uint16_t pc = g.fg ? fg : bg;
+            for (int32_t t = np * ts; t > 0; t--) *p++ = pc;
+            k += np;
+            g.run -= np;
+          }
+        } break;
+        case RUN_GFXFF: {
+          if (r < g.top || r >= g.top + g.gh) break;
+          uint32_t bit = (uint32_t)(r - g.top) * g.gw;
+          for (uint8_t k = 0; k < g.gw; k++, bit++, p += ts) {
+            if (pgm_read_byte(g.data + (bit >> 3)) & (0x80 >> (bit & 7))) for (uint8_t t = 0; t < ts; t++) p[t] = fg;
+          }
+        } break;
+      }
+    }
+
+    for (uint8_t t = 0; t < ts; t++) {
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA) || defined (HOST_FRAMEBUFFER)
+      if (dma) { pushPixelsDMA(buf, bw); continue; }
+#endif
+      pushPixels(buf, bw);
+    }
+    if (dma) buf = (buf == lineBuf) ? lineBuf + bw : lineBuf;
+  }
+
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA) || defined (HOST_FRAMEBUFFER)
+  if (dma) dmaWait();
+#endif
+  end_tft_write();
+
+  _swapBytes = swap;
+
+  return adv * ts;
+}
+
+
 /***************************************************************************************
 ** Function name:           drawCentreString (deprecated, use setTextDatum())
 ** Descriptions:            draw string centred on dX
@@ -6147,6 +6983,8 @@ void TFT_eSPI::getSetup(setup_t &tft_settings)
 
 #include "Extensions/Sprite.cpp"
 
+#include "Extensions/Compositor.cpp"
+
 #ifdef SMOOTH_FONT
   #include "Extensions/Smooth_font.cpp"
 #endif
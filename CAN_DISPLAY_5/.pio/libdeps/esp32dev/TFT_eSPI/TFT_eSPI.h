@@ -27,10 +27,12 @@
 ***************************************************************************************/
 
 //Standard support
-#include <Arduino.h>
-#include <Print.h>
-#if !defined (TFT_PARALLEL_8_BIT) && !defined (RP2040_PIO_INTERFACE)
-  #include <SPI.h>
+#if !defined (HOST_FRAMEBUFFER) // Host builds get an Arduino API subset from TFT_eSPI_Host.h
+  #include <Arduino.h>
+  #include <Print.h>
+  #if !defined (TFT_PARALLEL_8_BIT) && !defined (RP2040_PIO_INTERFACE)
+    #include <SPI.h>
+  #endif
 #endif
 /***************************************************************************************
 **                         Section 2: Load library and processor specific header files
@@ -93,7 +95,9 @@
 #endif
 
 // Include the processor specific drivers
-#if defined(CONFIG_IDF_TARGET_ESP32S3)
+#if defined (HOST_FRAMEBUFFER)
+  #include "Processors/TFT_eSPI_Host.h"
+#elif defined(CONFIG_IDF_TARGET_ESP32S3)
   #include "Processors/TFT_eSPI_ESP32_S3.h"
 #elif defined(CONFIG_IDF_TARGET_ESP32C3)
   #include "Processors/TFT_eSPI_ESP32_C3.h"
@@ -110,6 +114,18 @@
   #define GENERIC_PROCESSOR
 #endif
 
+// Processors whose pixel write functions keep the display RAM shadow up to date, see createShadow()
+#if defined (ESP32) || defined (HOST_FRAMEBUFFER)
+  #define SHADOW_SUPPORT
+  #define SHADOW_WINDOW(X0, Y0, X1, Y1) if (_shadow) shadowWindow(X0, Y0, X1, Y1)
+  #define SHADOW_BLOCK(C, L)            if (_shadow) shadowWrite(nullptr, C, L, false)
+  #define SHADOW_PIXELS(D, L, S)        if (_shadow) shadowWrite((const uint16_t*)(D), 0, L, S)
+#else
+  #define SHADOW_WINDOW(X0, Y0, X1, Y1)
+  #define SHADOW_BLOCK(C, L)
+  #define SHADOW_PIXELS(D, L, S)
+#endif
+
 /***************************************************************************************
 **                         Section 3: Interface setup
 ***************************************************************************************/
@@ -171,6 +187,10 @@
 // Set flag so RLE rendering code is optionally compiled
 #ifdef LOAD_GLCD
   #include <Fonts/glcdfont.c>
+  // Largest text size drawn in a single window, sets a 12 byte per size line buffer on the stack
+  #ifndef GLCD_MAX_SCALE
+    #define GLCD_MAX_SCALE 8
+  #endif
 #endif
 
 #ifdef LOAD_FONT2
@@ -278,6 +298,38 @@ const PROGMEM fontinfo fontdata [] = {
   #endif
 };
 
+#ifdef SMOOTH_FONT
+// Smooth font baked into a header by Tools/Bake_Smooth_Font, loaded with loadFont(font)
+// without any RAM allocation. The metric arrays are the ones loadMetrics() builds in RAM,
+// in ascending Unicode order.
+#define SMOOTH_ALPHA8 0 // 1 byte of alpha per pixel, as in a vlw file
+#define SMOOTH_ALPHA4 1 // 2 pixels per byte, high nibble first, alpha = nibble * 17
+#define SMOOTH_RLE4   2 // Runs within each row, a byte of run type and length then any data:
+                        //   00nnnnnn  n + 1 transparent pixels
+                        //   01nnnnnn  n + 1 opaque pixels
+                        //   10nnnnnn  n + 1 partial pixels, then (n + 2) / 2 bytes of 4-bit alpha
+
+typedef struct {
+    const uint8_t  *bitmaps;    // Glyph alpha data, PROGMEM
+    const uint32_t *bitmap;     // Offset of each glyph in bitmaps
+    const uint16_t *unicode;    // Unicode of each glyph
+    const uint8_t  *height;     // Bitmap height
+    const uint8_t  *width;      // Bitmap width
+    const uint8_t  *xAdvance;   // Cursor advance
+    const int16_t  *dY;         // Bitmap top above the baseline
+    const int8_t   *dX;         // Bitmap left edge from the cursor
+    const uint16_t *ascii;      // Glyph index for codes 0-127, 0xFFFF if not in the font
+    uint16_t gCount;            // Number of glyphs
+    uint16_t yAdvance;          // Line advance
+    uint16_t spaceWidth;        // Width of a space character
+    int16_t  ascent;            // Height of top of 'd' above baseline
+    int16_t  descent;           // Offset to bottom of 'p'
+    uint16_t maxAscent;         // Maximum ascent found in font
+    uint16_t maxDescent;        // Maximum descent found in font
+    uint8_t  format;            // SMOOTH_ALPHA8, SMOOTH_ALPHA4 or SMOOTH_RLE4
+} smoothFont;
+#endif
+
 /***************************************************************************************
 **                         Section 5: Font datum enumeration
 ***************************************************************************************/
@@ -471,6 +523,13 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
 
   void     invertDisplay(bool i);  // Tell TFT to invert all displayed colours
 
+  // Hardware vertical scrolling in display RAM rows (the rotation 0 y axis): rows top to
+  // top + rows - 1 scroll, the rows above and below stay put. Both return false, and do
+  // nothing, if the driver has no scroll commands (TFT_VSCRDEF in xxx_Defines.h), the panel is
+  // smaller than the controller RAM (CGRAM_OFFSET) or for a Sprite
+  bool     setScrollArea(uint16_t top, uint16_t rows);
+  bool     scrollTo(uint16_t line); // Show display RAM row line at the top of the scroll area
+
 
   // The TFT_eSprite class inherits the following functions (not all are useful to Sprite class
   void     setAddrWindow(int32_t xs, int32_t ys, int32_t w, int32_t h); // Note: start coordinates + width and height
@@ -518,8 +577,11 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color),
            fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
 
-  void     fillRectVGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2);
-  void     fillRectHGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2);
+           // Linear gradient from color1 at the top (left, top left corner) to color2 at the bottom
+           // (right, bottom right corner). dither = true adds a 4x4 ordered dither to reduce banding
+  void     fillRectVGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2, bool dither = false);
+  void     fillRectHGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2, bool dither = false);
+  void     fillRectDGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t color1, uint32_t color2, bool dither = false);
 
   void     drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color),
            drawCircleHelper(int32_t x, int32_t y, int32_t r, uint8_t cornername, uint32_t color),
@@ -548,8 +610,13 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // As per "drawSmoothArc" except the ends of the arc are NOT anti-aliased, this facilitates dynamic arc length changes with
            // arc segments and ensures clean segment joints. 
            // The sides of the arc are anti-aliased by default. If smoothArc is false sides will NOT be anti-aliased
+           // The edge alpha values for the last radii drawn are kept in RAM (about 16 bytes per pixel of radius)
   void     drawArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle, uint32_t fg_color, uint32_t bg_color, bool smoothArc = true);
 
+           // Move the end of an arc drawn clockwise from startAngle, e.g. a gauge value, from oldEnd to newEnd.
+           // Only the arc between the two ends is drawn, in fg_color if the arc grew or track_color if it shrank
+  void     updateArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t oldEnd, uint32_t newEnd, uint32_t fg_color, uint32_t track_color, uint32_t bg_color, bool smoothArc = true);
+
            // Draw an anti-aliased filled circle at x, y with radius r
            // Note: The thickness of line is 3 pixels to reduce the visible "braiding" effect of anti-aliasing narrow lines
            //       this means the inner anti-alias zone is always at r-1 and the outer zone at r+1
@@ -739,6 +806,12 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // 24-bit colour alphaBlend with optional alpha dither
   uint32_t alphaBlend24(uint8_t alpha, uint32_t fgc, uint32_t bgc, uint8_t dither = 0);
 
+           // Blend a span of len 16-bit colours in place, bgc[i] = alphaBlend(alpha[i], fgc, bgc[i])
+           // Colours are in processor byte order, not swapped as in a 16-bit sprite buffer
+  void     alphaBlendSpan(const uint8_t *alpha, uint16_t fgc, uint16_t *bgc, uint32_t len);
+           // As above with a colour per pixel, bgc[i] = alphaBlend(alpha[i], fgc[i], bgc[i])
+  void     alphaBlendSpan(const uint8_t *alpha, const uint16_t *fgc, uint16_t *bgc, uint32_t len);
+
   // Direct Memory Access (DMA) support functions
   // These can be used for SPI writes when using the ESP32 (original) or STM32 processors.
   // DMA also works on a RP2040 processor with PIO based SPI and parallel (8 and 16-bit) interfaces
@@ -784,7 +857,7 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // in progress, this simplifies the sketch and helps avoid "gotchas".
   void     pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr);
 
-#if defined (ESP32) // ESP32 only at the moment
+#if defined (ESP32) || defined (HOST_FRAMEBUFFER) // ESP32 only at the moment
            // For case where pointer is a const and the image data must not be modified (clipped or byte swapped)
   void     pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t const* data);
 #endif
@@ -798,6 +871,30 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   bool     DMA_Enabled = false;   // Flag for DMA enabled state
   uint8_t  spiBusyCheck = 0;      // Number of ESP32 transfer buffers to check
 
+#if defined (SHADOW_SUPPORT)
+           // Keep a copy of the display RAM in memory, so readPixel() and readRect() need no
+           // bus reads. Anti-aliased drawing with no background colour given (drawWedgeLine(),
+           // drawSmoothArc(), fillSmoothCircle(), drawPixel() with alpha...) then blends with
+           // the screen at memory speed. bits is 16 for exact colours or 8 to halve the memory,
+           // the colours read back are then quantised to RGB332. The shadow starts black, so
+           // create it before drawing the screen. It is kept up to date by the library drawing
+           // functions, pushPixels(), pushBlock() and the DMA functions, but not by data sent
+           // with writecommand() and writedata(). setRotation() to a different rotation
+           // deletes it. Returns false if there is not enough memory.
+  bool     createShadow(uint8_t bits = 16);
+  void     deleteShadow(void);
+  bool     shadowCreated(void) { return _shadow != nullptr; }
+#endif
+
+#if defined (HOST_FRAMEBUFFER)
+           // Native host build only, see Processors/TFT_eSPI_Host.h
+  uint16_t* framebuffer(void);            // Display RAM, TFT_WIDTH x TFT_HEIGHT RGB565 pixels in rotation 0 layout
+  const host_bus_stats& busStats(void);   // Bus traffic since the last resetBusStats()
+  void     resetBusStats(void);
+  bool     savePPM(const char *filename); // Save the display RAM as a PPM image, false on file error
+  uint16_t* screen(void);                 // The image on the panel, the display RAM after hardware scrolling
+#endif
+
   // Bare metal functions
   void     startWrite(void);                         // Begin SPI transaction
   void     writeColor(uint16_t color, uint32_t len); // Deprecated, use pushBlock()
@@ -864,6 +961,21 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // Same as setAddrWindow but exits with CGRAM in read mode
   void     readAddrWindow(int32_t xs, int32_t ys, int32_t w, int32_t h);
 
+#if defined (SHADOW_SUPPORT)
+           // Display RAM shadow: window and cursor of the pixel stream, write len pixels
+           // (data, or color if data is nullptr, swap if data is in panel byte order)
+  void     shadowWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+  void     shadowWrite(const uint16_t *data, uint16_t color, uint32_t len, bool swap);
+  uint16_t shadowRead(int32_t x, int32_t y);
+
+  void    *_shadow;            // Display RAM copy, _shadowWidth x _shadowHeight pixels
+  uint8_t  _shadowBits;        // 16 (RGB565) or 8 (RGB332) bits per pixel
+  uint8_t  _shadowRotation;    // Rotation the shadow was made in
+  int32_t  _shadowWidth, _shadowHeight;
+  int32_t  _shadowX0, _shadowY0, _shadowX1, _shadowY1; // Window, empty if _shadowX1 < _shadowX0
+  int32_t  _shadowX, _shadowY;                         // Next pixel in the window
+#endif
+
            // Byte read prototype
   uint8_t  readByte(void);
 
@@ -876,8 +988,34 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
            // Smooth graphics helper
   uint8_t  sqrt_fraction(uint32_t num);
 
+           // One row of an arc quadrant, by cx as in drawArc(): outer AA pixels from xs, the solid
+           // fill from fs to fe - 1, inner AA pixels from fe to ie - 1
+  typedef struct {
+    int16_t  xs, fs, fe, ie;
+    uint32_t aa;   // Index of the first alpha of the row, outer then inner pixels
+  } arcRow;
+
+           // Rows of an arc quadrant for one pair of radii, the alpha values follow the rows
+  typedef struct {
+    int32_t  r, ir;
+    bool     smooth;
+    arcRow  *row;  // row[i] is for cy = r - 1 - i, with r the outer AA radius
+    uint8_t *alpha;
+  } arcQuadrant;
+
+  static arcQuadrant *arcCache; // Last arc radii drawn, gauges redraw the same arc every frame
+
+  const arcQuadrant* arcProfile(int32_t r, int32_t ir, bool smooth);
+  uint32_t arcRowScan(int32_t r, int32_t cy, int32_t *xs, uint32_t r1, uint32_t r2, uint32_t r3, uint32_t r4, arcRow *row, uint8_t *alpha);
+  void     drawArcRow(int32_t px, int32_t py, int32_t c0, int32_t c1, int32_t step, const arcRow *row, const uint8_t *alpha, uint32_t fg_color, uint32_t bg_color, bool direct);
+
            // Helper function: calculate distance of a point from a finite length line between two points
   float    wedgeLineDistance(float pax, float pay, float bax, float bay, float dr);
+           // Helper function: x range of a row that is within distance k of the wedge line
+  bool     wedgeLineSpan(float ypay, float k, float bax, float bay, float dr, float *lo, float *hi);
+
+           // Helper function: fill a rectangle from a colour ramp, dir is 0 = vertical, 1 = horizontal, 2 = diagonal
+  void     fillRectGradient(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color1, uint16_t color2, uint8_t dir, bool dither);
 
            // Display variant settings
   uint8_t  tabcolor,                   // ST7735 screen protector "tab" colour (now invalid)
@@ -905,6 +1043,14 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
  //-------------------------------------- protected ----------------------------------//
  protected:
 
+           // Draw an opaque string and its padding in one window, used by drawString()
+           // Virtual so the TFT_eSprite class can opt out, returns -1 if not drawn
+  virtual int32_t drawStringRun(const char *string, int32_t x, int32_t y, uint8_t font, int32_t xo, int32_t w, int32_t padL, int32_t padR);
+
+           // True if drawing code may set an address window and write pixels to it directly.
+           // The TFT_eSprite class returns false, callers then use drawPixel() and drawFastHLine()
+  virtual bool    directWrite(void) { return true; }
+
   //int32_t  win_xe, win_ye;          // Window end coords - not needed
 
   int32_t  _init_width, _init_height; // Display w/h as input, used by setRotation()
@@ -1008,4 +1154,7 @@ fastBlend(A alpha, F fgc, B bgc)
 // Load the Sprite Class
 #include "Extensions/Sprite.h"
 
+// Load the Compositor Class
+#include "Extensions/Compositor.h"
+
 #endif // ends #ifndef _TFT_eSPIH_
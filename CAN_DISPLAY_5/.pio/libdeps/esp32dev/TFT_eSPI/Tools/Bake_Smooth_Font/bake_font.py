@@ -0,0 +1,178 @@
+'''
+
+    This script reads a smooth font vlw file (as made by the Processing sketch in
+    Tools/Create_Smooth_Font) and writes a C++ header with the font "baked" for use
+    with TFT_eSPI loadFont(const smoothFont &font).
+
+    loadFont() for a vlw array or file reads the header, mallocs the glyph metric
+    arrays, sorts them and builds the ASCII lookup table at run time. The baked
+    header has all of these as const arrays, so loading a font is a few pointer
+    assignments and uses no heap.
+
+    You'll need python 3.6 or later
+
+    usage: python bake_font.py [-v] NotoSansBold36.vlw [-o NotoSansBold36_baked.h] [-n name] [-a 4 | -c]
+
+'''
+
+import sys
+import struct
+import argparse
+import os
+
+parser = argparse.ArgumentParser(description="Convert a smooth font vlw file to a baked C++ header")
+parser.add_argument("-v", "--verbose", help="print the font metrics", action="store_true")
+parser.add_argument("input", help="input vlw file name")
+parser.add_argument("-o", "--output", help="output file name, default is <name>.h")
+parser.add_argument("-n", "--name", help="C identifier for the font, default is from the file name")
+parser.add_argument("-a", "--alpha", help="bits of alpha per pixel, 8 (exact) or 4 (half the flash)",
+                    type=int, choices=[8, 4], default=8)
+parser.add_argument("-c", "--compress", help="store runs of transparent, opaque and 4-bit alpha pixels",
+                    action="store_true")
+args = parser.parse_args()
+
+if not os.path.exists(args.input):
+    parser.print_help()
+    print("The input file {} does not exist".format(args.input))
+    sys.exit(1)
+
+name = args.name
+if name is None:
+    name = os.path.splitext(os.path.basename(args.input))[0]
+name = "".join(c if c.isalnum() else "_" for c in name)
+if name[0].isdigit():
+    name = "_" + name
+
+output = args.output if args.output else name + ".h"
+
+with open(args.input, "rb") as f:
+    contents = f.read()
+
+# Header is 6 big endian uint32_t: glyph count, version, size, mboxY, ascent, descent
+gCount, version, size, mboxY, ascent, descent = struct.unpack_from(">6I", contents, 0)
+
+# 7 int32_t per glyph: unicode, height, width, xAdvance, dY, dX, padding
+glyphs = []
+bitmapPtr = 24 + 28 * gCount
+for i in range(gCount):
+    unicode, height, width, xAdvance, dY, dX, pad = struct.unpack_from(">7i", contents, 24 + 28 * i)
+    height &= 0xFF
+    width  &= 0xFF
+    length = width * height
+    glyphs.append({
+        "unicode":  unicode & 0xFFFF,
+        "height":   height,
+        "width":    width,
+        "xAdvance": xAdvance & 0xFF,
+        "dY":       (dY + 0x8000 & 0xFFFF) - 0x8000, # int16_t
+        "dX":       (dX + 0x80 & 0xFF) - 0x80,       # int8_t
+        "alpha":    contents[bitmapPtr:bitmapPtr + length],
+    })
+    if len(glyphs[-1]["alpha"]) != length:
+        print("The input file {} is truncated".format(args.input))
+        sys.exit(1)
+    bitmapPtr += length
+
+# Same values as TFT_eSPI::loadFont() and loadMetrics()
+maxAscent  = ascent
+maxDescent = descent
+for g in glyphs:
+    u = g["unicode"]
+    if g["height"] - g["dY"] > maxDescent:
+        if (0x20 < u < 0xA0 and u != 0x7F) or u > 0xFF:
+            maxDescent = g["height"] - g["dY"]
+yAdvance   = maxAscent + maxDescent
+spaceWidth = (ascent + descent) * 2 // 7
+
+# Stable sort, duplicated codes keep their file order as sortMetrics() does
+glyphs.sort(key=lambda g: g["unicode"])
+
+asciiIndex = [0xFFFF] * 128
+for i in reversed(range(gCount)):
+    if glyphs[i]["unicode"] < 128:
+        asciiIndex[glyphs[i]["unicode"]] = i
+
+
+def runs(levels, width):
+    # Each row is split into runs of up to 64 transparent (level 0), opaque (level 15)
+    # or partial pixels, see SMOOTH_RLE4 in TFT_eSPI.h
+    out = bytearray()
+    for y in range(0, len(levels), width):
+        row = levels[y:y + width]
+        x = 0
+        while x < width:
+            kind = 0 if row[x] == 0 else 1 if row[x] == 15 else 2
+            n = 1
+            while x + n < width and n < 64:
+                k = 0 if row[x + n] == 0 else 1 if row[x + n] == 15 else 2
+                if k != kind:
+                    break
+                n += 1
+            out.append(kind << 6 | (n - 1))
+            if kind == 2:
+                part = row[x:x + n] + ([0] if n & 1 else [])
+                out += bytes(part[i] << 4 | part[i + 1] for i in range(0, len(part), 2))
+            x += n
+    return out
+
+
+# Bitmaps in glyph order, 4-bit alpha is rounded to the nearest of 16 levels
+bitmaps = bytearray()
+offsets = []
+for g in glyphs:
+    offsets.append(len(bitmaps))
+    if args.compress:
+        bitmaps += runs([min(15, (a + 8) // 17) for a in g["alpha"]], g["width"])
+    elif args.alpha == 8:
+        bitmaps += g["alpha"]
+    else:
+        levels = [min(15, (a + 8) // 17) for a in g["alpha"]]
+        if len(levels) & 1:
+            levels.append(0)
+        bitmaps += bytes(levels[i] << 4 | levels[i + 1] for i in range(0, len(levels), 2))
+
+if args.compress:
+    encoding, format = "alpha runs", "SMOOTH_RLE4"
+elif args.alpha == 8:
+    encoding, format = "8-bit alpha", "SMOOTH_ALPHA8"
+else:
+    encoding, format = "4-bit alpha", "SMOOTH_ALPHA4"
+
+if args.verbose:
+    print("{} glyphs, ascent {}, descent {}, maxDescent {}, yAdvance {}, spaceWidth {}".format(
+          gCount, ascent, descent, maxDescent, yAdvance, spaceWidth))
+    print("{} bytes of {}, vlw file was {} bytes".format(len(bitmaps), encoding, len(contents)))
+
+
+def array(ctype, suffix, values, perLine, fmt, progmem=False):
+    s = "const {} {}_{}[{}]{} = {{".format(ctype, name, suffix, len(values), " PROGMEM" if progmem else "")
+    for i, v in enumerate(values):
+        if i % perLine == 0:
+            s += "\n  "
+        s += fmt.format(v) + ", "
+    return s.rstrip(", ") + "\n};\n\n"
+
+
+guard = name.upper() + "_BAKED_H"
+out  = "// Smooth font baked from {} by Tools/Bake_Smooth_Font/bake_font.py\n".format(os.path.basename(args.input))
+out += "// {} glyphs, {} bytes of {}. Use with: tft.loadFont({});\n\n".format(
+       gCount, len(bitmaps), encoding, name)
+out += "#ifndef {}\n#define {}\n\n".format(guard, guard)
+out += array("uint8_t",  "bitmaps",  bitmaps, 16, "0x{:02X}", True)
+out += array("uint32_t", "bitmap",   offsets, 8, "{}")
+out += array("uint16_t", "unicode",  [g["unicode"] for g in glyphs], 8, "0x{:04X}")
+out += array("uint8_t",  "height",   [g["height"] for g in glyphs], 16, "{}")
+out += array("uint8_t",  "width",    [g["width"] for g in glyphs], 16, "{}")
+out += array("uint8_t",  "xAdvance", [g["xAdvance"] for g in glyphs], 16, "{}")
+out += array("int16_t",  "dY",       [g["dY"] for g in glyphs], 16, "{}")
+out += array("int8_t",   "dX",       [g["dX"] for g in glyphs], 16, "{}")
+out += array("uint16_t", "ascii",    asciiIndex, 16, "0x{:04X}")
+out += "const smoothFont {} = {{\n".format(name)
+for suffix in ["bitmaps", "bitmap", "unicode", "height", "width", "xAdvance", "dY", "dX", "ascii"]:
+    out += "  {}_{},\n".format(name, suffix)
+out += "  {}, {}, {}, {}, {}, {}, {},\n".format(gCount, yAdvance, spaceWidth, ascent, descent, maxAscent, maxDescent)
+out += "  {}\n}};\n\n".format(format)
+out += "#endif\n"
+
+with open(output, "w") as f:
+    f.write(out)
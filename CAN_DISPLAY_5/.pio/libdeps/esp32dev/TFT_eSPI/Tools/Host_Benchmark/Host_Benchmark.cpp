@@ -0,0 +1,379 @@
+/*
+  Micro-benchmarks for the TFT_eSPI drawing primitives, run natively on a host
+  computer against the HOST_FRAMEBUFFER processor driver (see Processors/TFT_eSPI_Host.h).
+
+  Build from the library folder (one line):
+    g++ -O2 -DHOST_FRAMEBUFFER -DUSER_SETUP_LOADED -DDISABLE_ALL_LIBRARY_WARNINGS
+        -include User_Setups/Setup500_Host_Framebuffer.h -I.
+        Tools/Host_Benchmark/Host_Benchmark.cpp TFT_eSPI.cpp -o Host_Benchmark
+
+  Usage:
+    ./Host_Benchmark [-f spi_hz] [-t min_ms] [name_filter]
+
+  One CSV line is printed per benchmark, after a header line:
+    name            benchmark name
+    iterations      calls timed
+    ns_per_op       host CPU time per call, including the display controller model
+    pixels_per_op   pixels written to display RAM per call
+    windows_per_op  address windows (setWindow calls) per call
+    bytes_per_op    bytes clocked out on the bus per call (commands + parameters + pixels)
+    bus_us_per_op   estimated bus time per call at the SPI clock rate
+    file_ops_per_op filing system read and seek calls per call
+
+  Run from the library folder, the filing system ("SPIFFS") font benchmarks load
+  NotoSansBold36.vlw from the Smooth Fonts/SPIFFS/Font_Demo_2 example.
+
+  CPU time is only meaningful relative to other runs on the same host, while the
+  pixel, window and byte counts are exact and should not change unless the way
+  a primitive drives the display changes. Compare two runs with diff to spot
+  regressions.
+*/
+
+#include <TFT_eSPI.h>
+
+#include "../../examples/Sprite/Animated_dial/NotoSansBold36.h"
+#include "NotoSansBold36_baked.h"   // Same font made by Tools/Bake_Smooth_Font
+#include "NotoSansBold36_rle.h"     // and with -c, runs of 4-bit alpha
+
+TFT_eSPI    tft;
+TFT_eSprite spr(&tft);
+
+// Test images for pushImage, sized for the largest colour depth
+#define IMG_W 64
+#define IMG_H 64
+static uint16_t img16[IMG_W * IMG_H];
+static uint8_t  img8[IMG_W * IMG_H];
+static uint8_t  img4[IMG_W * IMG_H / 2];
+static uint16_t cmap4[16];
+
+typedef struct {
+  const char *name;
+  void (*setup)(void);     // Untimed, run before the benchmark (may be nullptr)
+  void (*run)(void);       // Timed, must draw the same thing on every call
+  void (*teardown)(void);  // Untimed, run after the benchmark (may be nullptr)
+} benchmark_t;
+
+static void fontSetup(void)  { tft.setTextColor(TFT_WHITE, TFT_BLACK); tft.setTextDatum(MC_DATUM); tft.setTextSize(1); }
+static void clearSetup(void) { tft.setTextColor(TFT_WHITE); tft.setTextDatum(MC_DATUM); tft.setTextSize(1); }
+static void gfxSetup(void)   { fontSetup(); tft.setFreeFont(&FreeSans12pt7b); }
+static void gfxDown(void)    { tft.setFreeFont(nullptr); }
+static void vlwSetup(void)   { fontSetup(); tft.loadFont(NotoSansBold36); }
+static void vlwDown(void)    { tft.unloadFont(); }
+static void bakedSetup(void) { fontSetup(); tft.loadFont(NotoSansBold36_baked); }
+static void rleSetup(void)   { fontSetup(); tft.loadFont(NotoSansBold36_rle); }
+static void vlwFsSetup(void) { fontSetup(); tft.setGlyphCache(0); tft.loadFont("NotoSansBold36"); }
+static void vlwFsCached(void){ fontSetup(); tft.setGlyphCache(8192); tft.loadFont("NotoSansBold36"); }
+static void vlwFsDown(void)  { tft.unloadFont(); tft.setGlyphCache(0); }
+static void sprDown(void)    { spr.deleteSprite(); }
+
+// Synthetic vlw font for the glyph lookup benchmarks, count glyphs with empty bitmaps:
+// ASCII first, then consecutive codes from U+0E01 (Thai) up, optionally stored in reverse
+static uint8_t *vlwSynth = nullptr;
+static uint16_t lookupCodes[16];
+volatile uint16_t lookupSink;
+
+static void put32(uint8_t *p, uint32_t v) { p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v; }
+
+static void synthSetup(uint16_t count, bool sorted) {
+  vlwSynth = (uint8_t*)calloc(24 + 28 * count + 4, 1);
+  put32(vlwSynth, count);
+  put32(vlwSynth + 4, 11);  // vlw version
+  put32(vlwSynth + 8, 20);  // point size
+  put32(vlwSynth + 16, 15); // ascent
+  put32(vlwSynth + 20, 5);  // descent
+  for (uint16_t i = 0; i < count; i++) {
+    uint16_t code = i < 95 ? 0x20 + i : 0x0E01 + i - 95;
+    put32(vlwSynth + 24 + 28 * (sorted ? i : count - 1 - i), code);
+  }
+  tft.loadFont(vlwSynth);
+
+  // Half ASCII and half from the end of the table, the worst case for a linear search
+  for (uint16_t i = 0; i < 16; i++) lookupCodes[i] = i < 8 ? "V52.81 A"[i] : 0x0E01 + count - 95 - 16 + i;
+}
+
+static void synthDown(void) { tft.unloadFont(); free(vlwSynth); vlwSynth = nullptr; }
+
+static void lookupRun(void) {
+  uint16_t gNum = 0;
+  for (uint16_t i = 0; i < 16; i++) if (tft.getUnicodeIndex(lookupCodes[i], &gNum)) lookupSink = gNum;
+}
+
+static void sprSetup(uint8_t bpp) {
+  spr.setColorDepth(bpp);
+  spr.createSprite(IMG_W, IMG_H);
+  spr.fillSprite(TFT_NAVY);
+  spr.fillCircle(IMG_W / 2, IMG_H / 2, IMG_W / 3, TFT_YELLOW);
+  spr.drawRect(0, 0, IMG_W, IMG_H, TFT_WHITE);
+  spr.setPivot(IMG_W / 2, IMG_H / 2);
+}
+
+// A full screen sprite scrolled left, as for a strip chart
+static void scrollSetup(uint8_t bpp) {
+  spr.setColorDepth(bpp);
+  spr.createSprite(240, 240);
+  spr.fillSprite(TFT_NAVY);
+  spr.fillCircle(120, 120, 80, TFT_YELLOW);
+  spr.setScrollRect(0, 0, 240, 240, TFT_BLACK);
+}
+
+// pushRotated_ sprite and angle, from a LUT made in advance
+static rotationLUT *lut = nullptr;
+static void lutSetup(uint8_t bpp) {
+  sprSetup(bpp);
+  tft.setPivot(120, 120);
+  lut = spr.createRotationLUT(30);
+}
+static void lutDown(void) { spr.deleteRotationLUT(lut); lut = nullptr; sprDown(); }
+
+// _shadow benchmarks blend with display RAM read back from a createShadow() copy
+static void shadowSetup(void) { tft.fillScreen(TFT_NAVY); tft.createShadow(); }
+static void shadowDown(void)  { tft.deleteShadow(); }
+
+// alphaBlend_ benchmarks blend a 4096 pixel span over the same background on every call
+#define BLEND_N 4096
+static uint8_t  blendAlpha[BLEND_N];
+static uint16_t blendFg[BLEND_N], blendBg[BLEND_N], blendOut[BLEND_N];
+static void blendSetup(void) {
+  uint32_t r = 1;
+  for (uint32_t i = 0; i < BLEND_N; i++) {
+    r = r * 1103515245 + 12345;
+    blendAlpha[i] = (i & 3) ? r >> 24 : (i & 4) * 63;  // Include alpha 0 and 252 runs as for glyph edges
+    blendFg[i] = r >> 8; blendBg[i] = r >> 16;
+  }
+}
+static void blendPixel(void) {
+  for (uint32_t i = 0; i < BLEND_N; i++) blendOut[i] = tft.alphaBlend(blendAlpha[i], TFT_ORANGE, blendBg[i]);
+}
+
+// panel_ benchmarks draw six gradient bars, a label and a needle, in a full screen
+// sprite or with the compositor a 16 row band at a time
+static TFT_eCompositor comp(&tft);
+static void panelBars(TFT_eSprite *s, void *param) {
+  (void)param;
+  for (int32_t i = 0; i < 6; i++) s->fillRectVGradient(18 + i * 35, 60, 29, 120, TFT_GREEN, TFT_DARKGREEN);
+}
+static void panelNeedle(TFT_eSprite *s, void *param) { (void)param; s->drawWedgeLine(120, 200, 60, 120, 5, 1, TFT_RED); }
+static void panelSprite(void) {
+  spr.fillSprite(TFT_NAVY);
+  panelBars(&spr, nullptr);
+  spr.setTextColor(TFT_WHITE);
+  spr.setTextDatum(MC_DATUM);
+  spr.drawString("52.81 V", 120, 30, 4);
+  panelNeedle(&spr, nullptr);
+  spr.pushSprite(0, 0);
+}
+static void compSetup(void) {
+  comp.begin(240, 240, 16);
+  comp.setBackground(TFT_NAVY);
+  comp.addLayer(panelBars, nullptr, 60, 120);
+  comp.addString("52.81 V", 120, 30, 4, MC_DATUM, TFT_WHITE);
+  comp.addLayer(panelNeedle, nullptr, 115, 90);
+}
+static void compDown(void) { comp.end(); }
+
+// A gauge arc from 30 to 330 degrees swept up and back in 5 degree steps, 120 frames
+#define GAUGE_STEP 5
+static void gaugeSweepFull(void) {
+  for (int32_t i = 0; i < 120; i++) {
+    uint32_t v = 30 + GAUGE_STEP * (i < 60 ? i + 1 : 119 - i);
+    tft.drawArc(120, 120, 110, 90, 30, v, TFT_GREEN, TFT_BLACK);
+    if (v < 330) tft.drawArc(120, 120, 110, 90, v, 330, TFT_DARKGREY, TFT_BLACK);
+  }
+}
+
+static void gaugeSweepDelta(void) {
+  uint32_t v = 30;
+  for (int32_t i = 0; i < 120; i++) {
+    uint32_t n = 30 + GAUGE_STEP * (i < 60 ? i + 1 : 119 - i);
+    tft.updateArc(120, 120, 110, 90, 30, v, n, TFT_GREEN, TFT_DARKGREY, TFT_BLACK);
+    v = n;
+  }
+}
+
+static const benchmark_t benchmarks[] = {
+  { "fillScreen",          nullptr,   [](){ tft.fillScreen(TFT_BLUE); }, nullptr },
+  { "fillRect_100x100",    nullptr,   [](){ tft.fillRect(70, 70, 100, 100, TFT_RED); }, nullptr },
+  { "fillRectVGradient",   nullptr,   [](){ tft.fillRectVGradient(20, 30, 200, 180, TFT_NAVY, TFT_CYAN); }, nullptr },
+  { "fillRectHGradient",   nullptr,   [](){ tft.fillRectHGradient(20, 30, 200, 180, TFT_NAVY, TFT_CYAN); }, nullptr },
+  { "fillRectDGradient",   nullptr,   [](){ tft.fillRectDGradient(20, 30, 200, 180, TFT_NAVY, TFT_CYAN); }, nullptr },
+  { "fillRectVGradient_dither", nullptr, [](){ tft.fillRectVGradient(20, 30, 200, 180, TFT_NAVY, TFT_CYAN, true); }, nullptr },
+  { "fillRectDGradient_dither", nullptr, [](){ tft.fillRectDGradient(20, 30, 200, 180, TFT_NAVY, TFT_CYAN, true); }, nullptr },
+  { "drawFastHLine_200",   nullptr,   [](){ tft.drawFastHLine(20, 120, 200, TFT_GREEN); }, nullptr },
+  { "drawPixel",           nullptr,   [](){ tft.drawPixel(120, 120, TFT_WHITE); }, nullptr },
+  { "drawLine_diagonal",   nullptr,   [](){ tft.drawLine(20, 30, 220, 210, TFT_CYAN); }, nullptr },
+
+  { "drawString_font1",    fontSetup, [](){ tft.drawString("V 52.81", 120, 120, 1); }, nullptr },
+  { "drawString_font2",    fontSetup, [](){ tft.drawString("V 52.81", 120, 120, 2); }, nullptr },
+  { "drawString_font4",    fontSetup, [](){ tft.drawString("V 52.81", 120, 120, 4); }, nullptr },
+  { "drawString_font6",    fontSetup, [](){ tft.drawString("52.81", 120, 120, 6); }, nullptr },
+  { "drawString_font7",    fontSetup, [](){ tft.drawString("52.81", 120, 120, 7); }, nullptr },
+  { "drawString_font8",    fontSetup, [](){ tft.drawString("52.8", 120, 120, 8); }, nullptr },
+  { "drawString_font2_clear", clearSetup, [](){ tft.drawString("V 52.81", 120, 120, 2); }, nullptr },
+  { "drawString_font4_clear", clearSetup, [](){ tft.drawString("V 52.81", 120, 120, 4); }, nullptr },
+  { "drawString_font6_clear", clearSetup, [](){ tft.drawString("52.81", 120, 120, 6); }, nullptr },
+  { "drawString_font7_clear", clearSetup, [](){ tft.drawString("52.81", 120, 120, 7); }, nullptr },
+  { "drawString_font8_clear", clearSetup, [](){ tft.drawString("52.8", 120, 120, 8); }, nullptr },
+  { "drawString_font7_x2_clear", [](){ clearSetup(); tft.setTextSize(2); },
+                                      [](){ tft.drawString("52.8", 120, 120, 7); }, nullptr },
+  { "drawString_font4_pad", [](){ fontSetup(); tft.setTextPadding(160); },
+                                      [](){ tft.drawString("V 52.81", 120, 120, 4); }, [](){ tft.setTextPadding(0); } },
+  { "drawString_font1_x3", [](){ fontSetup(); tft.setTextSize(3); },
+                                      [](){ tft.drawString("V 52.81", 120, 120, 1); }, nullptr },
+  { "drawChar_font1_x1",   fontSetup, [](){ tft.drawChar(100, 100, '8', TFT_WHITE, TFT_BLACK, 1); }, nullptr },
+  { "drawChar_font1_x2",   fontSetup, [](){ tft.drawChar(100, 100, '8', TFT_WHITE, TFT_BLACK, 2); }, nullptr },
+  { "drawChar_font1_x3",   fontSetup, [](){ tft.drawChar(100, 100, '8', TFT_WHITE, TFT_BLACK, 3); }, nullptr },
+  { "drawChar_font1_x4",   fontSetup, [](){ tft.drawChar(100, 100, '8', TFT_WHITE, TFT_BLACK, 4); }, nullptr },
+  { "drawString_gfxff",    gfxSetup,  [](){ tft.drawString("V 52.81", 120, 120); }, gfxDown },
+  { "drawString_vlw",      vlwSetup,  [](){ tft.drawString("V 52.81", 120, 120); }, vlwDown },
+  { "drawString_vlw_baked", bakedSetup, [](){ tft.drawString("V 52.81", 120, 120); }, vlwDown },
+  { "drawString_vlw_rle",  rleSetup,  [](){ tft.drawString("V 52.81", 120, 120); }, vlwDown },
+  { "drawString_vlw_baked_fill", [](){ bakedSetup(); tft.setTextColor(TFT_WHITE, TFT_BLACK, true); },
+                                 [](){ tft.drawString("V 52.81", 120, 120); }, vlwDown },
+  { "drawString_vlw_rle_fill",   [](){ rleSetup(); tft.setTextColor(TFT_WHITE, TFT_BLACK, true); },
+                                 [](){ tft.drawString("V 52.81", 120, 120); }, vlwDown },
+  { "loadFont_vlw_array",  nullptr,   [](){ tft.loadFont(NotoSansBold36); tft.unloadFont(); }, nullptr },
+  { "loadFont_vlw_baked",  nullptr,   [](){ tft.loadFont(NotoSansBold36_baked); tft.unloadFont(); }, nullptr },
+  { "drawGlyph_vlw",       vlwSetup,  [](){ tft.setCursor(100, 100); tft.drawGlyph('8'); }, vlwDown },
+  { "drawString_vlw_fs",        vlwFsSetup,  [](){ tft.drawString("V 52.81", 120, 120); }, vlwFsDown },
+  { "drawString_vlw_fs_cached", vlwFsCached, [](){ tft.drawString("V 52.81", 120, 120); }, vlwFsDown },
+
+  // 16 glyph lookups per call, glyph count in the name
+  { "getUnicodeIndex_128",  [](){ synthSetup(128, true); },   lookupRun, synthDown },
+  { "getUnicodeIndex_384",  [](){ synthSetup(384, true); },   lookupRun, synthDown },
+  { "getUnicodeIndex_1024", [](){ synthSetup(1024, true); },  lookupRun, synthDown },
+  { "getUnicodeIndex_1024_unsorted", [](){ synthSetup(1024, false); }, lookupRun, synthDown },
+
+  { "drawSmoothArc_270",   nullptr,   [](){ tft.drawSmoothArc(120, 120, 110, 90, 45, 315, TFT_ORANGE, TFT_BLACK, true); }, nullptr },
+  { "drawArc_270",         nullptr,   [](){ tft.drawArc(120, 120, 110, 90, 45, 315, TFT_ORANGE, TFT_BLACK); }, nullptr },
+  { "gaugeSweep_full",     nullptr,   gaugeSweepFull, nullptr },
+  { "gaugeSweep_delta",    nullptr,   gaugeSweepDelta, nullptr },
+  { "drawWideLine_w5",     nullptr,   [](){ tft.drawWideLine(20, 40, 220, 190, 5, TFT_WHITE, TFT_BLACK); }, nullptr },
+  { "drawWedgeLine_needle", nullptr, [](){ tft.drawWedgeLine(120, 120, 40, 190, 6, 1, TFT_RED, TFT_BLACK); }, nullptr },
+  { "drawSpot_r4",         nullptr,   [](){ tft.drawSpot(120, 120, 4, TFT_WHITE, TFT_BLACK); }, nullptr },
+  { "fillSmoothCircle_50", nullptr,   [](){ tft.fillSmoothCircle(120, 120, 50, TFT_MAGENTA, TFT_BLACK); }, nullptr },
+  { "fillSmoothRoundRect", nullptr,   [](){ tft.fillSmoothRoundRect(40, 80, 160, 80, 12, TFT_DARKGREEN, TFT_BLACK); }, nullptr },
+
+  { "pushImage_16bpp",     nullptr,   [](){ tft.pushImage(88, 88, IMG_W, IMG_H, img16); }, nullptr },
+  { "pushImage_8bpp",      nullptr,   [](){ tft.pushImage(88, 88, IMG_W, IMG_H, img8, true); }, nullptr },
+  { "pushImage_4bpp",      nullptr,   [](){ tft.pushImage(88, 88, IMG_W, IMG_H, img4, false, cmap4); }, nullptr },
+  { "pushSprite_1bpp",     [](){ sprSetup(1); },  [](){ spr.pushSprite(88, 88); }, sprDown },
+  { "pushSprite_4bpp",     [](){ sprSetup(4); },  [](){ spr.pushSprite(88, 88); }, sprDown },
+  { "pushSprite_8bpp",     [](){ sprSetup(8); },  [](){ spr.pushSprite(88, 88); }, sprDown },
+  { "pushSprite_16bpp",    [](){ sprSetup(16); }, [](){ spr.pushSprite(88, 88); }, sprDown },
+  { "spriteScroll_1bpp",   [](){ scrollSetup(1); },  [](){ spr.scroll(-1); }, sprDown },
+  { "spriteScroll_4bpp",   [](){ scrollSetup(4); },  [](){ spr.scroll(-1); }, sprDown },
+  { "spriteScroll_4bpp_x2",[](){ scrollSetup(4); },  [](){ spr.scroll(-2); }, sprDown },
+  { "spriteScroll_8bpp",   [](){ scrollSetup(8); },  [](){ spr.scroll(-1); }, sprDown },
+  { "spriteScroll_16bpp",  [](){ scrollSetup(16); }, [](){ spr.scroll(-1); }, sprDown },
+  { "pushRotated_16bpp",   [](){ sprSetup(16); tft.setPivot(120, 120); },
+                                      [](){ spr.pushRotated(30); }, sprDown },
+  { "pushRotated_8bpp",    [](){ sprSetup(8); tft.setPivot(120, 120); },
+                                      [](){ spr.pushRotated(30); }, sprDown },
+  { "pushRotated_4bpp",    [](){ sprSetup(4); tft.setPivot(120, 120); },
+                                      [](){ spr.pushRotated(30); }, sprDown },
+  { "pushRotated_1bpp",    [](){ sprSetup(1); tft.setPivot(120, 120); },
+                                      [](){ spr.pushRotated(30); }, sprDown },
+  { "pushRotated_16bpp_tr",[](){ sprSetup(16); tft.setPivot(120, 120); },
+                                      [](){ spr.pushRotated(30, TFT_BLACK); }, sprDown },
+  { "pushRotated_16bpp_lut",[](){ lutSetup(16); }, [](){ spr.pushRotated(lut); }, lutDown },
+  { "pushRotated_4bpp_lut",[](){ lutSetup(4); },  [](){ spr.pushRotated(lut); }, lutDown },
+  { "pushRotated_16bpp_lut_tr",[](){ lutSetup(16); }, [](){ spr.pushRotated(lut, TFT_BLACK); }, lutDown },
+  { "alphaBlend_4k",       blendSetup, blendPixel, nullptr },
+  { "alphaBlendSpan_4k",   blendSetup, [](){ memcpy(blendOut, blendBg, sizeof(blendOut));
+                                             tft.alphaBlendSpan(blendAlpha, TFT_ORANGE, blendOut, BLEND_N); }, nullptr },
+  { "alphaBlendSpan_4k_fgc", blendSetup, [](){ memcpy(blendOut, blendBg, sizeof(blendOut));
+                                             tft.alphaBlendSpan(blendAlpha, blendFg, blendOut, BLEND_N); }, nullptr },
+  { "panel_sprite",        [](){ spr.setColorDepth(16); spr.createSprite(240, 240); }, panelSprite, sprDown },
+  { "panel_compositor",    compSetup, [](){ comp.render(0, 0); }, compDown },
+  { "panel_compositor_rows", compSetup, [](){ comp.render(0, 0, 112, 96); }, compDown },
+  { "drawWedgeLine_read",  nullptr,   [](){ tft.drawWedgeLine(20, 40, 220, 190, 6, 2, TFT_WHITE); }, nullptr },
+  { "drawWedgeLine_shadow", shadowSetup, [](){ tft.drawWedgeLine(20, 40, 220, 190, 6, 2, TFT_WHITE); }, shadowDown },
+  { "drawSmoothArc_read",  nullptr,   [](){ tft.drawSmoothArc(120, 120, 110, 90, 45, 315, TFT_ORANGE, 0x00FFFFFF, true); }, nullptr },
+  { "drawSmoothArc_shadow", shadowSetup, [](){ tft.drawSmoothArc(120, 120, 110, 90, 45, 315, TFT_ORANGE, 0x00FFFFFF, true); }, shadowDown },
+  { "fillSmoothCircle_read", nullptr, [](){ tft.fillSmoothCircle(120, 120, 50, TFT_MAGENTA, 0x00FFFFFF); }, nullptr },
+  { "fillSmoothCircle_shadow", shadowSetup, [](){ tft.fillSmoothCircle(120, 120, 50, TFT_MAGENTA, 0x00FFFFFF); }, shadowDown },
+};
+
+/***************************************************************************************
+** Function name:           nowNs
+** Description:             Monotonic clock in nanoseconds
+***************************************************************************************/
+static uint64_t nowNs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/***************************************************************************************
+** Function name:           runBenchmark
+** Description:             Time one benchmark and print its CSV line
+***************************************************************************************/
+static void runBenchmark(const benchmark_t& b, uint32_t spiHz, uint32_t minMs)
+{
+  tft.fillScreen(TFT_BLACK);
+  if (b.setup) b.setup();
+  b.run(); // Warm up, e.g. the first smooth font glyph lookups
+
+  // Double the iteration count until the run is long enough to time reliably
+  uint32_t n = 1;
+  uint64_t t;
+  for (;;) {
+    tft.resetBusStats();
+    t = nowNs();
+    for (uint32_t i = 0; i < n; i++) b.run();
+    t = nowNs() - t;
+    if (t >= minMs * 1000000ULL || n >= (1UL << 30)) break;
+    n *= 2;
+  }
+
+  const host_bus_stats& s = tft.busStats();
+  printf("%s,%u,%.1f,%.1f,%.2f,%.1f,%.2f,%.1f,%.1f\n", b.name, n,
+         (double)t / n,
+         (double)s.pixels / n,
+         (double)s.windows / n,
+         (double)s.bytes / n,
+         ((double)s.bytes * 8.0 * 1e6 / spiHz + (double)s.readBytes * 8.0 * 1e6 / SPI_READ_FREQUENCY) / n,
+         (double)(s.fileReads + s.fileSeeks) / n,
+         (double)s.readBytes / n);
+
+  if (b.teardown) b.teardown();
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t    spiHz  = SPI_FREQUENCY;
+  uint32_t    minMs  = 100;
+  const char *filter = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-f") && i + 1 < argc) spiHz = strtoul(argv[++i], nullptr, 0);
+    else if (!strcmp(argv[i], "-t") && i + 1 < argc) minMs = strtoul(argv[++i], nullptr, 0);
+    else if (argv[i][0] != '-') filter = argv[i];
+    else {
+      fprintf(stderr, "Usage: %s [-f spi_hz] [-t min_ms] [name_filter]\n", argv[0]);
+      return 1;
+    }
+  }
+  if (spiHz == 0) spiHz = SPI_FREQUENCY;
+
+  for (uint32_t i = 0; i < IMG_W * IMG_H; i++) {
+    img16[i] = (uint16_t)(i * 37);
+    img8[i]  = (uint8_t)(i * 13);
+  }
+  for (uint32_t i = 0; i < sizeof(img4); i++) img4[i] = (uint8_t)(i * 7);
+  for (uint32_t i = 0; i < 16; i++) cmap4[i] = tft.color565(i * 16, 255 - i * 16, i * 8);
+
+  tft.init();
+  tft.setRotation(0);
+
+  SPIFFS.setRoot("examples/Smooth Fonts/SPIFFS/Font_Demo_2/data");
+
+  printf("name,iterations,ns_per_op,pixels_per_op,windows_per_op,bytes_per_op,bus_us_per_op,file_ops_per_op,read_bytes_per_op\n");
+  for (const benchmark_t& b : benchmarks) {
+    if (filter && !strstr(b.name, filter)) continue;
+    runBenchmark(b, spiHz, minMs);
+  }
+
+  return 0;
+}
@@ -0,0 +1,206 @@
+// Smooth font baked from NotoSansBold36_dial.vlw by Tools/Bake_Smooth_Font/bake_font.py
+// 11 glyphs, 2250 bytes of alpha runs. Use with: tft.loadFont(NotoSansBold36_rle);
+
+#ifndef NOTOSANSBOLD36_RLE_BAKED_H
+#define NOTOSANSBOLD36_RLE_BAKED_H
+
+const uint8_t NotoSansBold36_rle_bitmaps[2250] PROGMEM = {
+  0x01, 0x83, 0x47, 0x72, 0x00, 0x00, 0x80, 0xA0, 0x43, 0x80, 0x30, 0x80, 0x30, 0x44, 0x80, 0x90, 
+  0x80, 0x80, 0x44, 0x80, 0x90, 0x80, 0x70, 0x44, 0x80, 0x50, 0x81, 0x2E, 0x42, 0x80, 0xA0, 0x00, 
+  0x00, 0x83, 0x15, 0x63, 0x01, 0x12, 0x06, 0x82, 0x29, 0xD0, 0x42, 0x82, 0xD8, 0x10, 0x02, 0x05, 
+  0x80, 0x80, 0x47, 0x81, 0xE4, 0x01, 0x04, 0x80, 0xB0, 0x49, 0x81, 0xE2, 0x00, 0x03, 0x80, 0xA0, 
+  0x4B, 0x80, 0xA0, 0x00, 0x02, 0x80, 0x70, 0x44, 0x83, 0xC5, 0x5D, 0x44, 0x00, 0x01, 0x81, 0x1E, 
+  0x43, 0x81, 0xC1, 0x01, 0x80, 0x30, 0x44, 0x80, 0x40, 0x01, 0x80, 0x80, 0x44, 0x80, 0x20, 0x03, 
+  0x80, 0xE0, 0x43, 0x80, 0x50, 0x00, 0x81, 0x1E, 0x43, 0x80, 0x90, 0x04, 0x80, 0xB0, 0x43, 0x80, 
+  0x70, 0x00, 0x80, 0x60, 0x44, 0x80, 0x30, 0x04, 0x80, 0xB0, 0x43, 0x80, 0x80, 0x00, 0x80, 0xA0, 
+  0x43, 0x80, 0xD0, 0x05, 0x80, 0xE0, 0x43, 0x80, 0x60, 0x00, 0x44, 0x80, 0x90, 0x05, 0x80, 0xE0, 
+  0x43, 0x80, 0x60, 0x80, 0x30, 0x44, 0x80, 0x50, 0x05, 0x44, 0x80, 0x50, 0x80, 0x50, 0x44, 0x80, 
+  0x10, 0x04, 0x80, 0x20, 0x44, 0x80, 0x40, 0x80, 0x90, 0x43, 0x80, 0xE0, 0x05, 0x80, 0x50, 0x44, 
+  0x80, 0x10, 0x80, 0xA0, 0x43, 0x80, 0xA0, 0x05, 0x80, 0x80, 0x43, 0x80, 0xE0, 0x00, 0x80, 0xA0, 
+  0x43, 0x80, 0x90, 0x05, 0x80, 0xB0, 0x43, 0x80, 0xA0, 0x00, 0x80, 0xB0, 0x43, 0x80, 0x90, 0x04, 
+  0x80, 0x10, 0x44, 0x80, 0x70, 0x00, 0x80, 0xC0, 0x43, 0x80, 0x70, 0x04, 0x80, 0x60, 0x44, 0x80, 
+  0x20, 0x00, 0x80, 0xB0, 0x43, 0x80, 0x70, 0x04, 0x80, 0xC0, 0x43, 0x80, 0xC0, 0x01, 0x80, 0xA0, 
+  0x43, 0x80, 0x90, 0x03, 0x80, 0x40, 0x44, 0x80, 0x60, 0x01, 0x80, 0x90, 0x43, 0x80, 0xC0, 0x02, 
+  0x81, 0x1D, 0x43, 0x80, 0xE0, 0x02, 0x80, 0x50, 0x44, 0x80, 0x60, 0x00, 0x81, 0x3C, 0x44, 0x80, 
+  0x60, 0x02, 0x80, 0x10, 0x4C, 0x80, 0xB0, 0x03, 0x00, 0x80, 0x80, 0x4A, 0x81, 0xC1, 0x03, 0x01, 
+  0x80, 0xB0, 0x48, 0x81, 0xB1, 0x04, 0x02, 0x81, 0x7E, 0x44, 0x81, 0xC5, 0x06, 0x04, 0x84, 0x35, 
+  0x54, 0x10, 0x08, 0x08, 0x85, 0x4A, 0xAA, 0xA4, 0x06, 0x81, 0x2A, 0x44, 0x80, 0x40, 0x05, 0x81, 
+  0x7E, 0x45, 0x00, 0x03, 0x81, 0x3C, 0x46, 0x80, 0xD0, 0x00, 0x01, 0x81, 0x19, 0x48, 0x80, 0xA0, 
+  0x00, 0x00, 0x81, 0x5E, 0x49, 0x80, 0x60, 0x00, 0x80, 0x80, 0x45, 0x81, 0xDE, 0x43, 0x80, 0x30, 
+  0x00, 0x80, 0x20, 0x44, 0x81, 0xA2, 0x44, 0x01, 0x00, 0x80, 0x70, 0x41, 0x81, 0xD5, 0x00, 0x80, 
+  0x50, 0x43, 0x80, 0xC0, 0x01, 0x01, 0x82, 0xD9, 0x10, 0x01, 0x80, 0xA0, 0x43, 0x80, 0x90, 0x01, 
+  0x06, 0x80, 0xD0, 0x43, 0x80, 0x50, 0x01, 0x05, 0x80, 0x10, 0x44, 0x80, 0x20, 0x01, 0x05, 0x80, 
+  0x50, 0x43, 0x80, 0xE0, 0x02, 0x05, 0x80, 0x80, 0x43, 0x80, 0xA0, 0x02, 0x05, 0x80, 0xB0, 0x43, 
+  0x80, 0x80, 0x02, 0x05, 0x44, 0x80, 0x50, 0x02, 0x04, 0x80, 0x30, 0x44, 0x80, 0x10, 0x02, 0x04, 
+  0x80, 0x60, 0x43, 0x80, 0xD0, 0x03, 0x04, 0x80, 0xA0, 0x43, 0x80, 0xA0, 0x03, 0x04, 0x80, 0xD0, 
+  0x43, 0x80, 0x70, 0x03, 0x04, 0x44, 0x80, 0x40, 0x03, 0x03, 0x80, 0x40, 0x44, 0x04, 0x03, 0x80, 
+  0x70, 0x43, 0x80, 0xC0, 0x04, 0x03, 0x80, 0xA0, 0x43, 0x80, 0x90, 0x04, 0x03, 0x80, 0xE0, 0x43, 
+  0x80, 0x60, 0x04, 0x02, 0x80, 0x20, 0x44, 0x80, 0x30, 0x04, 0x14, 0x07, 0x82, 0x28, 0xC0, 0x43, 
+  0x82, 0xC7, 0x10, 0x02, 0x05, 0x81, 0x2A, 0x48, 0x81, 0xD3, 0x01, 0x04, 0x81, 0x6E, 0x4A, 0x81, 
+  0xE2, 0x00, 0x03, 0x80, 0x70, 0x4D, 0x80, 0xA0, 0x00, 0x03, 0x81, 0x2E, 0x43, 0x83, 0xB8, 0x7B, 
+  0x45, 0x00, 0x04, 0x80, 0x50, 0x41, 0x81, 0xC3, 0x03, 0x80, 0x90, 0x44, 0x80, 0x40, 0x05, 0x81, 
+  0xA8, 0x05, 0x80, 0x30, 0x44, 0x80, 0x40, 0x0D, 0x80, 0x20, 0x44, 0x80, 0x30, 0x0D, 0x80, 0x60, 
+  0x44, 0x00, 0x0D, 0x80, 0xC0, 0x43, 0x80, 0xA0, 0x00, 0x0C, 0x80, 0x70, 0x44, 0x80, 0x30, 0x00, 
+  0x0B, 0x80, 0x40, 0x44, 0x80, 0x90, 0x01, 0x0A, 0x81, 0x4E, 0x43, 0x80, 0xC0, 0x02, 0x09, 0x81, 
+  0x4E, 0x43, 0x81, 0xD1, 0x02, 0x08, 0x80, 0x50, 0x44, 0x81, 0xD1, 0x03, 0x07, 0x80, 0x70, 0x44, 
+  0x81, 0xC1, 0x04, 0x06, 0x80, 0x90, 0x44, 0x80, 0xA0, 0x06, 0x05, 0x80, 0xA0, 0x44, 0x80, 0x80, 
+  0x07, 0x03, 0x81, 0x1C, 0x43, 0x81, 0xE5, 0x08, 0x02, 0x81, 0x2D, 0x43, 0x81, 0xE3, 0x09, 0x01, 
+  0x81, 0x3E, 0x43, 0x81, 0xC1, 0x0A, 0x00, 0x81, 0x4E, 0x44, 0x89, 0xA9, 0x99, 0x99, 0x99, 0x99, 
+  0x02, 0x80, 0x20, 0x4F, 0x80, 0xB0, 0x02, 0x80, 0x50, 0x4F, 0x80, 0x90, 0x02, 0x80, 0x80, 0x4F, 
+  0x80, 0x50, 0x02, 0x80, 0xB0, 0x4F, 0x80, 0x20, 0x02, 0x13, 0x06, 0x82, 0x59, 0xD0, 0x43, 0x82, 
+  0xD9, 0x20, 0x02, 0x04, 0x81, 0x7D, 0x49, 0x80, 0x70, 0x01, 0x03, 0x80, 0xC0, 0x4C, 0x80, 0x60, 
+  0x00, 0x03, 0x80, 0x70, 0x4C, 0x80, 0xE0, 0x00, 0x04, 0x80, 0xD0, 0x41, 0x85, 0xC7, 0x55, 0x8E, 
+  0x44, 0x80, 0x40, 0x04, 0x82, 0x4C, 0x40, 0x04, 0x80, 0x50, 0x44, 0x80, 0x50, 0x0D, 0x44, 0x80, 
+  0x50, 0x0D, 0x44, 0x80, 0x30, 0x0C, 0x80, 0x60, 0x43, 0x80, 0xD0, 0x00, 0x0B, 0x81, 0x5E, 0x43, 
+  0x80, 0x50, 0x00, 0x07, 0x83, 0x14, 0x6B, 0x44, 0x80, 0x80, 0x01, 0x05, 0x80, 0xA0, 0x47, 0x81, 
+  0xE6, 0x02, 0x05, 0x80, 0xE0, 0x45, 0x81, 0xA5, 0x04, 0x04, 0x80, 0x10, 0x47, 0x81, 0xA3, 0x03, 
+  0x04, 0x84, 0x3B, 0xBB, 0xE0, 0x45, 0x80, 0x50, 0x02, 0x09, 0x81, 0x19, 0x44, 0x80, 0x20, 0x01, 
+  0x0B, 0x80, 0xB0, 0x43, 0x80, 0x90, 0x01, 0x0B, 0x80, 0x60, 0x43, 0x80, 0xA0, 0x01, 0x0B, 0x80, 
+  0x70, 0x43, 0x80, 0xB0, 0x01, 0x0B, 0x80, 0xB0, 0x43, 0x80, 0xA0, 0x01, 0x81, 0x51, 0x08, 0x80, 
+  0x70, 0x44, 0x80, 0x60, 0x01, 0x80, 0xB0, 0x40, 0x82, 0xA6, 0x30, 0x02, 0x82, 0x15, 0xB0, 0x44, 
+  0x81, 0xE1, 0x01, 0x80, 0xB0, 0x4E, 0x80, 0x70, 0x02, 0x80, 0xB0, 0x4D, 0x80, 0x90, 0x03, 0x80, 
+  0xB0, 0x4B, 0x81, 0xE6, 0x04, 0x82, 0x17, 0xC0, 0x47, 0x82, 0xC7, 0x10, 0x05, 0x03, 0x85, 0x34, 
+  0x55, 0x44, 0x09, 0x0D, 0x86, 0x3A, 0xAA, 0xAA, 0x30, 0x0C, 0x81, 0x2E, 0x44, 0x80, 0x20, 0x0B, 
+  0x81, 0x1C, 0x44, 0x80, 0xE0, 0x00, 0x0B, 0x80, 0xB0, 0x45, 0x80, 0xA0, 0x00, 0x0A, 0x80, 0x80, 
+  0x46, 0x80, 0x70, 0x00, 0x09, 0x80, 0x60, 0x47, 0x80, 0x40, 0x00, 0x08, 0x80, 0x30, 0x43, 0x80, 
+  0xE0, 0x43, 0x80, 0x10, 0x00, 0x07, 0x81, 0x2E, 0x42, 0x81, 0x9E, 0x42, 0x80, 0xD0, 0x01, 0x06, 
+  0x81, 0x1C, 0x42, 0x81, 0xD5, 0x43, 0x80, 0xA0, 0x01, 0x06, 0x80, 0xB0, 0x43, 0x81, 0x38, 0x43, 
+  0x80, 0x60, 0x01, 0x05, 0x80, 0x80, 0x43, 0x80, 0x50, 0x00, 0x80, 0xB0, 0x43, 0x80, 0x40, 0x01, 
+  0x04, 0x80, 0x60, 0x43, 0x80, 0x80, 0x01, 0x44, 0x02, 0x03, 0x80, 0x30, 0x43, 0x80, 0xA0, 0x01, 
+  0x80, 0x40, 0x43, 0x80, 0xC0, 0x02, 0x02, 0x81, 0x2E, 0x42, 0x80, 0xC0, 0x02, 0x80, 0x70, 0x43, 
+  0x80, 0x90, 0x02, 0x01, 0x81, 0x1C, 0x42, 0x81, 0xD1, 0x02, 0x80, 0xA0, 0x43, 0x80, 0x50, 0x02, 
+  0x01, 0x80, 0xB0, 0x42, 0x81, 0xE3, 0x03, 0x80, 0xE0, 0x43, 0x80, 0x30, 0x02, 0x00, 0x80, 0x70, 
+  0x43, 0x85, 0xC9, 0x99, 0x99, 0x44, 0x82, 0x99, 0x80, 0x00, 0x00, 0x80, 0xC0, 0x50, 0x80, 0xB0, 
+  0x00, 0x00, 0x51, 0x80, 0x80, 0x00, 0x80, 0x30, 0x51, 0x80, 0x50, 0x00, 0x8A, 0x3A, 0xAA, 0xAA, 
+  0xAA, 0xAA, 0xA0, 0x44, 0x83, 0xAA, 0xA1, 0x00, 0x09, 0x80, 0x30, 0x43, 0x80, 0xE0, 0x04, 0x09, 
+  0x80, 0x60, 0x43, 0x80, 0xA0, 0x04, 0x09, 0x80, 0xA0, 0x43, 0x80, 0x70, 0x04, 0x09, 0x80, 0xD0, 
+  0x43, 0x80, 0x40, 0x04, 0x08, 0x80, 0x10, 0x44, 0x05, 0x05, 0x8D, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 
+  0xAA, 0xA7, 0x05, 0x80, 0xB0, 0x4B, 0x80, 0x90, 0x04, 0x80, 0x10, 0x4C, 0x80, 0x50, 0x04, 0x80, 
+  0x50, 0x4C, 0x80, 0x20, 0x04, 0x80, 0x90, 0x43, 0x88, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x04, 
+  0x80, 0xE0, 0x43, 0x80, 0x10, 0x08, 0x03, 0x80, 0x30, 0x43, 0x80, 0xB0, 0x09, 0x03, 0x80, 0x70, 
+  0x43, 0x80, 0x70, 0x09, 0x03, 0x80, 0xB0, 0x43, 0x80, 0x20, 0x09, 0x03, 0x43, 0x80, 0xD0, 0x00, 
+  0x81, 0x33, 0x07, 0x02, 0x80, 0x50, 0x48, 0x81, 0xC6, 0x04, 0x02, 0x80, 0x90, 0x4A, 0x81, 0xC1, 
+  0x02, 0x02, 0x80, 0xD0, 0x4B, 0x80, 0xB0, 0x02, 0x02, 0x80, 0x90, 0x4C, 0x80, 0x40, 0x01, 0x03, 
+  0x82, 0x55, 0x20, 0x02, 0x81, 0x4C, 0x44, 0x80, 0xA0, 0x01, 0x0A, 0x81, 0x1E, 0x43, 0x80, 0xC0, 
+  0x01, 0x0B, 0x80, 0xA0, 0x43, 0x80, 0xE0, 0x01, 0x0B, 0x80, 0x90, 0x43, 0x80, 0xD0, 0x01, 0x0B, 
+  0x80, 0xB0, 0x43, 0x80, 0xA0, 0x01, 0x0A, 0x80, 0x20, 0x44, 0x80, 0x80, 0x01, 0x81, 0x64, 0x07, 
+  0x81, 0x1C, 0x44, 0x80, 0x30, 0x01, 0x80, 0x90, 0x40, 0x83, 0xD8, 0x41, 0x01, 0x82, 0x37, 0xE0, 
+  0x44, 0x80, 0xB0, 0x02, 0x80, 0x90, 0x4D, 0x81, 0xE2, 0x02, 0x80, 0x90, 0x4D, 0x80, 0x50, 0x03, 
+  0x80, 0x80, 0x4B, 0x81, 0xD3, 0x04, 0x00, 0x81, 0x6A, 0x47, 0x81, 0xB6, 0x06, 0x03, 0x85, 0x24, 
+  0x55, 0x43, 0x09, 0x13, 0x08, 0x83, 0x16, 0xAD, 0x43, 0x82, 0xEB, 0x20, 0x07, 0x81, 0x8E, 0x48, 
+  0x00, 0x05, 0x81, 0x3D, 0x49, 0x80, 0xC0, 0x00, 0x04, 0x81, 0x3E, 0x4A, 0x80, 0x90, 0x00, 0x03, 
+  0x81, 0x2E, 0x44, 0x87, 0xD8, 0x54, 0x45, 0x74, 0x00, 0x03, 0x80, 0xC0, 0x43, 0x81, 0xE6, 0x08, 
+  0x02, 0x80, 0x70, 0x43, 0x81, 0xE3, 0x09, 0x01, 0x81, 0x1E, 0x43, 0x80, 0x40, 0x0A, 0x01, 0x80, 
+  0x70, 0x43, 0x80, 0x90, 0x0B, 0x01, 0x80, 0xD0, 0x43, 0x80, 0x20, 0x00, 0x85, 0x49, 0xAA, 0x72, 
+  0x04, 0x00, 0x80, 0x40, 0x43, 0x82, 0xB2, 0xC0, 0x45, 0x80, 0x70, 0x03, 0x00, 0x80, 0x80, 0x43, 
+  0x81, 0x7E, 0x47, 0x80, 0x60, 0x02, 0x00, 0x80, 0xC0, 0x43, 0x80, 0xE0, 0x48, 0x80, 0xE0, 0x02, 
+  0x00, 0x46, 0x83, 0xB7, 0x8E, 0x44, 0x80, 0x40, 0x01, 0x80, 0x30, 0x45, 0x80, 0x50, 0x02, 0x80, 
+  0x20, 0x44, 0x80, 0x60, 0x01, 0x80, 0x50, 0x44, 0x80, 0x70, 0x04, 0x80, 0xC0, 0x43, 0x80, 0x90, 
+  0x01, 0x80, 0x50, 0x44, 0x05, 0x80, 0xB0, 0x43, 0x80, 0x80, 0x01, 0x80, 0x60, 0x43, 0x80, 0xB0, 
+  0x05, 0x80, 0xC0, 0x43, 0x80, 0x50, 0x01, 0x80, 0x60, 0x43, 0x80, 0xA0, 0x05, 0x44, 0x80, 0x30, 
+  0x01, 0x80, 0x50, 0x43, 0x80, 0xC0, 0x04, 0x80, 0x60, 0x43, 0x80, 0xE0, 0x02, 0x80, 0x30, 0x44, 
+  0x80, 0x20, 0x02, 0x81, 0x1D, 0x43, 0x80, 0x90, 0x02, 0x00, 0x80, 0xE0, 0x43, 0x81, 0xB2, 0x00, 
+  0x81, 0x3C, 0x44, 0x80, 0x20, 0x02, 0x00, 0x80, 0x80, 0x4C, 0x80, 0x90, 0x03, 0x00, 0x81, 0x1E, 
+  0x4A, 0x80, 0xC0, 0x04, 0x01, 0x81, 0x3E, 0x48, 0x81, 0xB1, 0x04, 0x02, 0x81, 0x2A, 0x45, 0x81, 
+  0xC5, 0x06, 0x05, 0x84, 0x45, 0x54, 0x10, 0x08, 0x02, 0x91, 0x8A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
+  0xAA, 0xAA, 0xA3, 0x02, 0x50, 0x80, 0x20, 0x01, 0x80, 0x30, 0x4F, 0x80, 0xE0, 0x00, 0x01, 0x80, 
+  0x60, 0x4F, 0x80, 0xA0, 0x00, 0x01, 0x8A, 0x9E, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x45, 0x80, 0x30, 
+  0x00, 0x0B, 0x81, 0x1E, 0x43, 0x80, 0x80, 0x01, 0x0B, 0x80, 0xA0, 0x43, 0x81, 0xE1, 0x01, 0x0A, 
+  0x80, 0x40, 0x44, 0x80, 0x60, 0x02, 0x0A, 0x80, 0xD0, 0x43, 0x80, 0xC0, 0x03, 0x09, 0x80, 0x70, 
+  0x44, 0x80, 0x30, 0x03, 0x08, 0x80, 0x20, 0x44, 0x80, 0x90, 0x04, 0x08, 0x80, 0xB0, 0x43, 0x81, 
+  0xE1, 0x04, 0x07, 0x80, 0x50, 0x44, 0x80, 0x60, 0x05, 0x06, 0x81, 0x1D, 0x43, 0x80, 0xC0, 0x06, 
+  0x06, 0x80, 0x80, 0x44, 0x80, 0x40, 0x06, 0x05, 0x80, 0x30, 0x44, 0x80, 0xA0, 0x07, 0x05, 0x80, 
+  0xC0, 0x43, 0x81, 0xE2, 0x07, 0x04, 0x80, 0x60, 0x44, 0x80, 0x70, 0x08, 0x03, 0x81, 0x1E, 0x43, 
+  0x80, 0xD0, 0x09, 0x03, 0x80, 0x90, 0x44, 0x80, 0x40, 0x09, 0x02, 0x80, 0x30, 0x44, 0x80, 0xA0, 
+  0x0A, 0x02, 0x80, 0xC0, 0x44, 0x80, 0x20, 0x0A, 0x01, 0x80, 0x70, 0x44, 0x80, 0x70, 0x0B, 0x00, 
+  0x81, 0x2E, 0x43, 0x80, 0xD0, 0x0C, 0x00, 0x80, 0xA0, 0x44, 0x80, 0x50, 0x0C, 0x80, 0x40, 0x44, 
+  0x80, 0xB0, 0x0D, 0x12, 0x06, 0x82, 0x5A, 0xE0, 0x42, 0x82, 0xEA, 0x50, 0x02, 0x04, 0x81, 0x2C, 
+  0x48, 0x81, 0xB1, 0x00, 0x03, 0x81, 0x2E, 0x4A, 0x80, 0xB0, 0x00, 0x03, 0x80, 0xC0, 0x44, 0x81, 
+  0xEE, 0x45, 0x80, 0x40, 0x02, 0x80, 0x50, 0x44, 0x80, 0x50, 0x01, 0x81, 0x2E, 0x43, 0x80, 0xA0, 
+  0x02, 0x80, 0xA0, 0x43, 0x80, 0x80, 0x03, 0x80, 0x60, 0x43, 0x80, 0xB0, 0x02, 0x80, 0xB0, 0x43, 
+  0x80, 0x40, 0x03, 0x80, 0x50, 0x43, 0x80, 0xA0, 0x02, 0x80, 0xB0, 0x43, 0x80, 0x50, 0x03, 0x80, 
+  0x70, 0x43, 0x80, 0x90, 0x02, 0x80, 0xA0, 0x43, 0x80, 0xA0, 0x02, 0x81, 0x1D, 0x43, 0x80, 0x30, 
+  0x02, 0x80, 0x40, 0x44, 0x80, 0x60, 0x00, 0x81, 0x3D, 0x43, 0x80, 0x90, 0x00, 0x03, 0x80, 0xA0, 
+  0x44, 0x80, 0xC0, 0x44, 0x80, 0xB0, 0x01, 0x03, 0x81, 0x1C, 0x47, 0x81, 0xE7, 0x02, 0x04, 0x80, 
+  0x60, 0x46, 0x81, 0xB1, 0x03, 0x02, 0x81, 0x5D, 0x48, 0x80, 0x80, 0x03, 0x01, 0x80, 0x90, 0x44, 
+  0x81, 0xED, 0x44, 0x80, 0x90, 0x02, 0x00, 0x80, 0x90, 0x44, 0x81, 0x81, 0x00, 0x80, 0xA0, 0x44, 
+  0x80, 0x40, 0x01, 0x80, 0x30, 0x44, 0x80, 0x40, 0x03, 0x80, 0xB0, 0x43, 0x80, 0xB0, 0x01, 0x80, 
+  0xA0, 0x43, 0x80, 0x80, 0x04, 0x80, 0x30, 0x44, 0x01, 0x80, 0xE0, 0x43, 0x80, 0x40, 0x05, 0x44, 
+  0x80, 0x10, 0x00, 0x44, 0x80, 0x40, 0x05, 0x44, 0x80, 0x10, 0x00, 0x44, 0x80, 0x60, 0x04, 0x80, 
+  0x50, 0x43, 0x80, 0xE0, 0x01, 0x80, 0xC0, 0x43, 0x81, 0xE3, 0x02, 0x81, 0x2E, 0x43, 0x80, 0x90, 
+  0x01, 0x80, 0x70, 0x45, 0x82, 0xBA, 0xB0, 0x45, 0x80, 0x20, 0x01, 0x00, 0x80, 0xC0, 0x4C, 0x80, 
+  0x70, 0x02, 0x00, 0x81, 0x1D, 0x4A, 0x80, 0x60, 0x03, 0x02, 0x81, 0x7D, 0x45, 0x82, 0xE9, 0x20, 
+  0x04, 0x04, 0x85, 0x14, 0x55, 0x42, 0x07, 0x12, 0x05, 0x82, 0x39, 0xD0, 0x42, 0x82, 0xEA, 0x40, 
+  0x03, 0x03, 0x81, 0x1A, 0x48, 0x80, 0xA0, 0x02, 0x02, 0x81, 0x1D, 0x4A, 0x80, 0xA0, 0x01, 0x02, 
+  0x80, 0xB0, 0x4C, 0x80, 0x40, 0x00, 0x01, 0x80, 0x60, 0x44, 0x83, 0xC5, 0x47, 0x44, 0x80, 0xA0, 
+  0x00, 0x01, 0x80, 0xD0, 0x43, 0x80, 0xC0, 0x03, 0x80, 0x80, 0x43, 0x80, 0xE0, 0x00, 0x00, 0x80, 
+  0x40, 0x44, 0x80, 0x20, 0x03, 0x80, 0x30, 0x44, 0x00, 0x00, 0x80, 0x80, 0x43, 0x80, 0xB0, 0x04, 
+  0x80, 0x10, 0x44, 0x80, 0x20, 0x00, 0x80, 0xA0, 0x43, 0x80, 0x90, 0x04, 0x80, 0x20, 0x44, 0x80, 
+  0x40, 0x00, 0x80, 0xB0, 0x43, 0x80, 0x60, 0x04, 0x80, 0x50, 0x44, 0x80, 0x20, 0x00, 0x80, 0xC0, 
+  0x43, 0x80, 0x80, 0x04, 0x80, 0xA0, 0x44, 0x00, 0x00, 0x80, 0xA0, 0x43, 0x80, 0xC0, 0x03, 0x80, 
+  0x60, 0x45, 0x00, 0x00, 0x80, 0x80, 0x44, 0x83, 0xA4, 0x49, 0x45, 0x80, 0xD0, 0x00, 0x00, 0x80, 
+  0x30, 0x4E, 0x80, 0xA0, 0x00, 0x01, 0x80, 0xA0, 0x47, 0x81, 0xEB, 0x43, 0x80, 0x60, 0x00, 0x01, 
+  0x81, 0x1C, 0x45, 0x82, 0xE3, 0xD0, 0x43, 0x80, 0x30, 0x00, 0x03, 0x87, 0x7B, 0xEE, 0xD8, 0x13, 
+  0x43, 0x80, 0xD0, 0x01, 0x0A, 0x80, 0xA0, 0x43, 0x80, 0x80, 0x01, 0x09, 0x80, 0x30, 0x44, 0x80, 
+  0x20, 0x01, 0x08, 0x81, 0x1C, 0x43, 0x80, 0xA0, 0x02, 0x07, 0x81, 0x1C, 0x44, 0x80, 0x20, 0x02, 
+  0x82, 0x46, 0x30, 0x02, 0x82, 0x38, 0xE0, 0x44, 0x80, 0x70, 0x03, 0x80, 0x60, 0x4B, 0x80, 0xB0, 
+  0x04, 0x80, 0x60, 0x4A, 0x80, 0xB0, 0x05, 0x80, 0x60, 0x48, 0x81, 0xE7, 0x06, 0x80, 0x50, 0x46, 
+  0x82, 0xD8, 0x10, 0x07, 0x01, 0x85, 0x34, 0x55, 0x41, 0x0A
+};
+
+const uint32_t NotoSansBold36_rle_bitmap[11] = {
+  0, 37, 307, 490, 681, 883, 1113, 1315, 
+  1560, 1747, 2007
+};
+
+const uint16_t NotoSansBold36_rle_unicode[11] = {
+  0x002E, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 
+  0x0037, 0x0038, 0x0039
+};
+
+const uint8_t NotoSansBold36_rle_height[11] = {
+  7, 28, 26, 27, 28, 26, 27, 28, 26, 28, 28
+};
+
+const uint8_t NotoSansBold36_rle_width[11] = {
+  7, 19, 15, 21, 20, 21, 20, 20, 21, 19, 19
+};
+
+const uint8_t NotoSansBold36_rle_xAdvance[11] = {
+  10, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20
+};
+
+const int16_t NotoSansBold36_rle_dY[11] = {
+  6, 27, 26, 27, 27, 26, 26, 27, 26, 27, 27
+};
+
+const int8_t NotoSansBold36_rle_dX[11] = {
+  0, 1, 3, -1, 0, -1, 0, 1, 1, 1, 1
+};
+
+const uint16_t NotoSansBold36_rle_ascii[128] = {
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+  0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+const smoothFont NotoSansBold36_rle = {
+  NotoSansBold36_rle_bitmaps,
+  NotoSansBold36_rle_bitmap,
+  NotoSansBold36_rle_unicode,
+  NotoSansBold36_rle_height,
+  NotoSansBold36_rle_width,
+  NotoSansBold36_rle_xAdvance,
+  NotoSansBold36_rle_dY,
+  NotoSansBold36_rle_dX,
+  NotoSansBold36_rle_ascii,
+  11, 37, 10, 28, 9, 28, 9,
+  SMOOTH_RLE4
+};
+
+#endif
@@ -0,0 +1,118 @@
+/*
+  Checks alphaBlendSpan() against alphaBlend(), run natively on a host computer against the
+  HOST_FRAMEBUFFER processor driver (see Processors/TFT_eSPI_Host.h).
+
+  Build from the library folder (one line):
+    g++ -O2 -DHOST_FRAMEBUFFER -DUSER_SETUP_LOADED -DDISABLE_ALL_LIBRARY_WARNINGS
+        -include User_Setups/Setup500_Host_Framebuffer.h -I.
+        Tools/Host_Tests/Alpha_Blend_Span_Test.cpp TFT_eSPI.cpp -o Alpha_Blend_Span_Test
+
+  On an SSE2 host spans are blended 8 pixels at a time by blend8() and the rest by the
+  scalar loop, add -U__SSE2__ to the build line to check the scalar loop on its own.
+
+  Usage:
+    ./Alpha_Blend_Span_Test
+
+  Red and blue are blended together in one word by alphaBlend(), so every alpha is
+  checked with every pair of foreground and background red and blue values, 2^28 pixels,
+  with the green values chosen so every pair of green values is also met at every alpha.
+  This is done for both alphaBlendSpan() overloads, then spans of 0 to 40 pixels at odd
+  offsets check the pixels left over after the 8 pixel blocks. Every pixel must equal
+  alphaBlend() exactly.
+
+  Returns 0 if every pixel matches.
+*/
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI tft;
+
+#define SPAN 1024 // Every red and blue pair
+
+static uint8_t  alpha[SPAN];
+static uint16_t fg[SPAN];
+static uint16_t bg[SPAN];
+static uint16_t out[SPAN];
+
+static uint32_t failed = 0;
+
+static void check(const char *name, uint32_t len, const uint8_t *a, const uint16_t *f, const uint16_t *b, const uint16_t *o)
+{
+  for (uint32_t i = 0; i < len; i++)
+  {
+    uint16_t want = tft.alphaBlend(a[i], f[i], b[i]);
+    if (o[i] == want) continue;
+    if (++failed <= 10) printf("%s: alpha %u fg %04X bg %04X is %04X, alphaBlend() %04X\n", name, a[i], f[i], b[i], o[i], want);
+  }
+}
+
+// Colour from red and blue in rb (5 bits each) and a 6-bit green
+static uint16_t rgb(uint32_t rb, uint32_t g)
+{
+  return (rb >> 5) << 11 | (g & 0x3F) << 5 | (rb & 0x1F);
+}
+
+int main(void)
+{
+  // Every alpha, foreground red and blue, and background red and blue, one fgc per span
+  for (uint32_t a = 0; a < 256; a++)
+  {
+    memset(alpha, a, SPAN);
+    for (uint32_t f = 0; f < SPAN; f++)
+    {
+      uint16_t fgc = rgb(f, f);
+      for (uint32_t b = 0; b < SPAN; b++) { fg[b] = fgc; bg[b] = rgb(b, b + (f >> 6)); }
+      memcpy(out, bg, sizeof(bg));
+      tft.alphaBlendSpan(alpha, fgc, out, SPAN);
+      check("alphaBlendSpan(fgc)", SPAN, alpha, fg, bg, out);
+    }
+  }
+
+  // The same with a colour per pixel, the foreground red and blue change along the span
+  for (uint32_t a = 0; a < 256; a++)
+  {
+    memset(alpha, a, SPAN);
+    for (uint32_t b = 0; b < SPAN; b++)
+    {
+      uint16_t bgc = rgb(b, b);
+      for (uint32_t f = 0; f < SPAN; f++) { fg[f] = rgb(f, f + (b >> 6)); bg[f] = bgc; }
+      memcpy(out, bg, sizeof(bg));
+      tft.alphaBlendSpan(alpha, fg, out, SPAN);
+      check("alphaBlendSpan(fgc[])", SPAN, alpha, fg, bg, out);
+    }
+  }
+
+  // Short spans at odd offsets, random alpha and colours
+  uint32_t rng = 1;
+  for (uint32_t n = 0; n < 200000; n++)
+  {
+    uint32_t len = n % 41, off = (n / 41) % 7;
+    for (uint32_t i = 0; i < len + off; i++)
+    {
+      rng = rng * 1664525 + 1013904223; alpha[i] = rng >> 24;
+      if (!(rng & 0x300)) alpha[i] = (rng & 0x400) ? 255 : 0;
+      rng = rng * 1664525 + 1013904223; fg[i] = rng >> 16;
+      rng = rng * 1664525 + 1013904223; bg[i] = rng >> 16;
+    }
+    memcpy(out, bg, sizeof(bg));
+    if (n & 1) tft.alphaBlendSpan(alpha + off, fg + off, out + off, len);
+    else
+    {
+      for (uint32_t i = off; i < len + off; i++) fg[i] = fg[off];
+      tft.alphaBlendSpan(alpha + off, fg[off], out + off, len);
+    }
+    check("short span", len, alpha + off, fg + off, bg + off, out + off);
+    if (memcmp(out, bg, off * 2) || memcmp(out + off + len, bg + off + len, (SPAN - off - len) * 2))
+    {
+      if (++failed <= 10) printf("short span: pixels outside %u + %u changed\n", off, len);
+    }
+  }
+
+#if defined (HOST_SSE2)
+  const char *path = "SSE2 and scalar";
+#else
+  const char *path = "scalar";
+#endif
+  printf("Alpha_Blend_Span_Test (%s): %u pixels differ\n", path, failed);
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,221 @@
+/*
+  Checks TFT_eSprite::scroll() for 1 and 4 bpp Sprites, run natively on a host computer
+  against the HOST_FRAMEBUFFER processor driver (see Processors/TFT_eSPI_Host.h).
+
+  Build from the library folder (one line):
+    g++ -O2 -DHOST_FRAMEBUFFER -DUSER_SETUP_LOADED -DDISABLE_ALL_LIBRARY_WARNINGS
+        -include User_Setups/Setup500_Host_Framebuffer.h -I.
+        Tools/Host_Tests/Sprite_Scroll_Test.cpp TFT_eSPI.cpp -o Sprite_Scroll_Test
+
+  Usage:
+    ./Sprite_Scroll_Test [cases] [seed]
+
+  Each case fills two Sprites of a random size with the same random pixels, then sets a
+  random scroll zone, viewport, rotation and shift in all four directions. One Sprite is
+  scrolled with scroll(), the other with the per-pixel loop scroll() used for every 1 and
+  4 bpp Sprite before rows were moved with moveBits(). The Sprite buffers must be
+  byte-identical. When the row path is taken the result is also checked against the
+  pixels read straight from a copy of the buffer taken before the scroll.
+
+  Returns 0 if every case passes.
+*/
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI    tft;
+TFT_eSprite spr(&tft);
+TFT_eSprite ref(&tft);
+TFT_eSprite gap(&tft);
+
+static uint32_t rng = 1;
+static uint32_t rnd(uint32_t n) { rng = rng * 1664525 + 1013904223; return (rng >> 8) % n; }
+
+// Packed pixel at x, y of a buffer iw pixels wide, MSB first
+static uint8_t bitsAt(const uint8_t *buf, uint8_t bpp, int32_t iw, int32_t x, int32_t y)
+{
+  uint32_t p = (x + y * iw) * bpp;
+  return (buf[p >> 3] >> (8 - bpp - (p & 7))) & ((1 << bpp) - 1);
+}
+
+static void setBits(uint8_t *buf, uint8_t bpp, int32_t iw, int32_t x, int32_t y, uint8_t v)
+{
+  uint32_t p = (x + y * iw) * bpp;
+  uint8_t  s = 8 - bpp - (p & 7);
+  uint8_t  m = ((1 << bpp) - 1) << s;
+  buf[p >> 3] = (buf[p >> 3] & ~m) | ((v << s) & m);
+}
+
+// The per-pixel 1 and 4 bpp path of scroll(), through the public drawing functions
+static void scrollPixels(TFT_eSprite &s, int32_t sx, int32_t sy, int32_t sw, int32_t sh,
+                         uint16_t color, int16_t dx, int16_t dy)
+{
+  if (abs(dx) >= sw || abs(dy) >= sh)
+  {
+    s.fillRect (sx, sy, sw, sh, color);
+    return;
+  }
+
+  uint32_t w  = sw - abs(dx);
+  uint32_t h  = sh - abs(dy);
+  uint32_t tx = sx, fx = sx, ty = sy, fy = sy;
+
+  if (dx <= 0) fx -= dx;
+  else tx += dx;
+
+  if (dy <= 0) fy -= dy;
+  else
+  {
+    ty = ty + sh - 1;
+    fy = ty - dy;
+  }
+
+  if (dx >  0) { tx += w - 1; fx += w - 1; }
+  while (h--)
+  {
+    for (uint16_t xp = 0; xp < w; xp++)
+    {
+      if (dx <= 0) s.drawPixel(tx + xp, ty, s.readPixelValue(fx + xp, fy));
+      if (dx >  0) s.drawPixel(tx - xp, ty, s.readPixelValue(fx - xp, fy));
+    }
+    if (dy <= 0)  { ty++; fy++; }
+    else  { ty--; fy--; }
+  }
+
+  if (dx > 0) s.fillRect(sx, sy, dx, sh, color);
+  if (dx < 0) s.fillRect(sx + sw + dx, sy, -dx, sh, color);
+  if (dy > 0) s.fillRect(sx, sy, sw, dy, color);
+  if (dy < 0) s.fillRect(sx, sy + sh + dy, sw, -dy, color);
+}
+
+static bool runCase(uint32_t n)
+{
+  uint8_t bpp = rnd(2) ? 4 : 1;
+  int16_t w   = 1 + rnd(80);
+  int16_t h   = 1 + rnd(40);
+
+  // Mostly rotation 0 and viewports holding the zone, so the row path is taken. The
+  // per-pixel path reads a rotated 1 bpp Sprite with readPixelValue(), which maps
+  // rotations 1 and 3 with width and height the other way round to drawPixel(), so
+  // rotated Sprites are square and a whole number of bytes wide
+  uint8_t rot = 0;
+  if (bpp == 1 && !rnd(4))
+  {
+    rot = rnd(4);
+    w = h = 8 * (1 + rnd(6));
+  }
+
+  spr.setColorDepth(bpp);
+  ref.setColorDepth(bpp);
+  spr.createSprite(w, h);
+  ref.createSprite(w, h);
+
+  int32_t iw    = (bpp == 4) ? (w + 1) & ~1 : (w + 7) & ~7;
+  size_t  bytes = (iw * h * bpp) >> 3;
+
+  uint8_t *a = (uint8_t *)spr.getPointer();
+  uint8_t *b = (uint8_t *)ref.getPointer();
+  for (size_t i = 0; i < bytes; i++) a[i] = rnd(256);
+  memcpy(b, a, bytes);
+
+  int32_t sx = rnd(iw), sy = rnd(h);
+  int32_t sw = 1 + rnd(iw - sx), sh = 1 + rnd(h - sy);
+  uint16_t color = rnd(16);
+  spr.setScrollRect(sx, sy, sw, sh, color);
+
+  spr.setRotation(rot);
+  ref.setRotation(rot);
+
+  // Viewport edges, clipped to the Sprite as setViewport() does
+  int32_t x0 = 0, y0 = 0, x1 = w, y1 = h;
+  bool datum = false;
+  if (rnd(3))
+  {
+    int32_t vx = rnd(w), vy = rnd(h);
+    int32_t vw = 1 + rnd(w - vx + 8), vh = 1 + rnd(h - vy + 8);
+    datum = !rnd(4);
+    spr.setViewport(vx, vy, vw, vh, datum);
+    ref.setViewport(vx, vy, vw, vh, datum);
+    x0 = vx; y0 = vy;
+    if (vx + vw < x1) x1 = vx + vw;
+    if (vy + vh < y1) y1 = vy + vh;
+  }
+
+  int16_t dx = 0, dy = 0;
+  switch (rnd(4))
+  {
+    case 0: dx = -(int16_t)rnd(sw + 1); break;
+    case 1: dx =  (int16_t)rnd(sw + 1); break;
+    case 2: dy = -(int16_t)rnd(sh + 1); break;
+    case 3: dy =  (int16_t)rnd(sh + 1); break;
+  }
+  if (!rnd(4)) { dx = (int16_t)rnd(2 * sw + 1) - sw; dy = (int16_t)rnd(2 * sh + 1) - sh; }
+
+  // The row path is taken when the zone is inside an unrotated viewport with no datum offset
+  bool rows = rot == 0 && (!datum || (x0 == 0 && y0 == 0)) &&
+              sx >= x0 && sy >= y0 && sx + sw <= x1 && sy + sh <= y1;
+
+  // Gap value as stored by fillRect()
+  uint8_t gapBits = 0;
+  if (rows)
+  {
+    gap.setColorDepth(bpp);
+    gap.createSprite(8, 1);
+    gap.fillRect(0, 0, 1, 1, color);
+    gapBits = bitsAt((uint8_t *)gap.getPointer(), bpp, 8, 0, 0);
+    gap.deleteSprite();
+  }
+
+  uint8_t *before = (uint8_t *)malloc(bytes);
+  memcpy(before, a, bytes);
+
+  spr.scroll(dx, dy);
+  scrollPixels(ref, sx, sy, sw, sh, color, dx, dy);
+
+  bool ok = memcmp(a, b, bytes) == 0;
+  if (!ok) printf("case %u: %d bpp %dx%d rot %d zone %d,%d %dx%d shift %d,%d differs from per-pixel path\n",
+                  n, bpp, w, h, rot, sx, sy, sw, sh, dx, dy);
+
+  if (ok && rows)
+  {
+    // Every zone pixel comes from dx, dy back inside the zone, or is the gap colour
+    uint8_t *want = (uint8_t *)malloc(bytes);
+    memcpy(want, before, bytes);
+    for (int32_t y = sy; y < sy + sh; y++)
+    {
+      for (int32_t x = sx; x < sx + sw; x++)
+      {
+        int32_t fx = x - dx, fy = y - dy;
+        bool in = fx >= sx && fx < sx + sw && fy >= sy && fy < sy + sh;
+        setBits(want, bpp, iw, x, y, in ? bitsAt(before, bpp, iw, fx, fy) : gapBits);
+      }
+    }
+    ok = memcmp(a, want, bytes) == 0;
+    if (!ok) printf("case %u: %d bpp %dx%d zone %d,%d %dx%d shift %d,%d differs from reference\n",
+                    n, bpp, w, h, sx, sy, sw, sh, dx, dy);
+    free(want);
+  }
+
+  free(before);
+  spr.setRotation(0);
+  ref.setRotation(0);
+  spr.deleteSprite();
+  ref.deleteSprite();
+  return ok;
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t cases = (argc > 1) ? atoi(argv[1]) : 20000;
+  rng = (argc > 2) ? atoi(argv[2]) : 1;
+
+  tft.init();
+
+  uint32_t failed = 0;
+  for (uint32_t n = 0; n < cases; n++)
+  {
+    if (!runCase(n) && ++failed >= 10) break;
+  }
+
+  printf("Sprite_Scroll_Test: %u cases, %u failed\n", cases, failed);
+  return failed ? 1 : 0;
+}
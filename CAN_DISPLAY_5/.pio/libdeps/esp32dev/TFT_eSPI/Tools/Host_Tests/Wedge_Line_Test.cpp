@@ -0,0 +1,290 @@
+/*
+  Checks drawWedgeLine() against the pixel by pixel version it replaced, run natively on a
+  host computer against the HOST_FRAMEBUFFER processor driver (see Processors/TFT_eSPI_Host.h).
+
+  Build from the library folder (one line):
+    g++ -O2 -DHOST_FRAMEBUFFER -DUSER_SETUP_LOADED -DDISABLE_ALL_LIBRARY_WARNINGS
+        -include User_Setups/Setup500_Host_Framebuffer.h -I.
+        Tools/Host_Tests/Wedge_Line_Test.cpp TFT_eSPI.cpp -o Wedge_Line_Test
+
+  Usage:
+    ./Wedge_Line_Test [cases] [seed]
+
+  Each case draws a random wedge, wide line or spot, with a background colour or with
+  the background read back (bg_color 0x00FFFFFF), over a random pattern on the TFT or
+  in a 16-bit Sprite, optionally clipped by a viewport. The same wedge is drawn again
+  over the same pattern twice:
+  - by allPixelsWedgeLine(), which evaluates every pixel of the box. The output must be
+    identical.
+  - by oldWedgeLine(), the scan drawWedgeLine() used before. Each pixel must be within
+    1 LSB in each of the red, green and blue channels, unless the old scan missed it
+    (it started each row at the previous row's first pixel and stopped at a gap).
+
+  The Setup500 GC9A01 draws each pixel and run on its own. Add -DHOST_ILI9341 to the
+  build line to check the one window per row path.
+
+  Returns 0 if every case passes.
+*/
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI    tft;
+TFT_eSprite spr(&tft);
+
+// Same as the drawWedgeLine() constants in TFT_eSPI.cpp
+static const float PixelAlphaGain  = 255.0;
+static const float LoAlphaTheshold = 1.0/32.0;
+static const float HiAlphaTheshold = 1.0 - LoAlphaTheshold;
+
+#define TEST_W 120
+#define TEST_H 100
+
+static uint32_t rng = 1;
+static uint32_t rnd(uint32_t n) { rng = rng * 1664525 + 1013904223; return (rng >> 8) % n; }
+static float    rndf(float lo, float hi) { return lo + (hi - lo) * rnd(10000) / 10000.0f; }
+
+static float wedgeLineDistance(float xpax, float ypay, float bax, float bay, float dr)
+{
+  float h = fmaxf(fminf((xpax * bax + ypay * bay) / (bax * bax + bay * bay), 1.0f), 0.0f);
+  float dx = xpax - bax * h, dy = ypay - bay * h;
+  return sqrtf(dx * dx + dy * dy) + h * dr;
+}
+
+// drawWedgeLine() before rows were drawn as spans, as built for the GC9A01 (one drawPixel()
+// per pixel). Viewports are used without a datum offset, the old code did not add it.
+template <typename T> static void oldWedgeLine(T &d, float ax, float ay, float bx, float by, float ar, float br, uint32_t fg_color, uint32_t bg_color)
+{
+  if ( (ar < 0.0) || (br < 0.0) )return;
+  if ( (fabsf(ax - bx) < 0.01f) && (fabsf(ay - by) < 0.01f) ) bx += 0.01f;  // Avoid divide by zero
+
+  // Find line bounding box
+  int32_t x0 = (int32_t)floorf(fminf(ax-ar, bx-br));
+  int32_t x1 = (int32_t) ceilf(fmaxf(ax+ar, bx+br));
+  int32_t y0 = (int32_t)floorf(fminf(ay-ar, by-br));
+  int32_t y1 = (int32_t) ceilf(fmaxf(ay+ar, by+br));
+
+  if (!d.clipWindow(&x0, &y0, &x1, &y1)) return;
+
+  // Establish x start and y start
+  int32_t ys = ay;
+  if ((ax-ar)>(bx-br)) ys = by;
+
+  float rdt = ar - br; // Radius delta
+  float alpha = 1.0f;
+  ar += 0.5;
+
+  uint16_t bg = bg_color;
+  float xpax, ypay, bax = bx - ax, bay = by - ay;
+
+  int32_t xs = x0;
+  // Scan bounding box from ys down, calculate pixel intensity from distance to line
+  for (int32_t yp = ys; yp <= y1; yp++) {
+    bool endX = false; // Flag to skip pixels
+    ypay = yp - ay;
+    for (int32_t xp = xs; xp <= x1; xp++) {
+      if (endX) if (alpha <= LoAlphaTheshold) break;  // Skip right side
+      xpax = xp - ax;
+      alpha = ar - wedgeLineDistance(xpax, ypay, bax, bay, rdt);
+      if (alpha <= LoAlphaTheshold ) continue;
+      // Track edge to minimise calculations
+      if (!endX) { endX = true; xs = xp; }
+      if (alpha > HiAlphaTheshold) {
+        d.drawPixel(xp, yp, fg_color);
+        continue;
+      }
+      //Blend color with background and plot
+      if (bg_color == 0x00FFFFFF) bg = d.readPixel(xp, yp);
+      d.drawPixel(xp, yp, fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
+    }
+  }
+
+  // Reset x start to left side of box
+  xs = x0;
+  // Scan bounding box from ys-1 up, calculate pixel intensity from distance to line
+  for (int32_t yp = ys-1; yp >= y0; yp--) {
+    bool endX = false; // Flag to skip pixels
+    ypay = yp - ay;
+    for (int32_t xp = xs; xp <= x1; xp++) {
+      if (endX) if (alpha <= LoAlphaTheshold) break;  // Skip right side of drawn line
+      xpax = xp - ax;
+      alpha = ar - wedgeLineDistance(xpax, ypay, bax, bay, rdt);
+      if (alpha <= LoAlphaTheshold ) continue;
+      // Track line boundary
+      if (!endX) { endX = true; xs = xp; }
+      if (alpha > HiAlphaTheshold) {
+        d.drawPixel(xp, yp, fg_color);
+        continue;
+      }
+      //Blend colour with background and plot
+      if (bg_color == 0x00FFFFFF) bg = d.readPixel(xp, yp);
+      d.drawPixel(xp, yp, fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
+    }
+  }
+}
+
+// Every pixel of the box from the same distance function and thresholds, the output
+// drawWedgeLine() must match exactly
+template <typename T> static void allPixelsWedgeLine(T &d, float ax, float ay, float bx, float by, float ar, float br, uint32_t fg_color, uint32_t bg_color)
+{
+  if ( (ar < 0.0) || (br < 0.0) )return;
+  if ( (fabsf(ax - bx) < 0.01f) && (fabsf(ay - by) < 0.01f) ) bx += 0.01f;
+
+  int32_t x0 = (int32_t)floorf(fminf(ax-ar, bx-br));
+  int32_t x1 = (int32_t) ceilf(fmaxf(ax+ar, bx+br));
+  int32_t y0 = (int32_t)floorf(fminf(ay-ar, by-br));
+  int32_t y1 = (int32_t) ceilf(fmaxf(ay+ar, by+br));
+
+  if (!d.clipWindow(&x0, &y0, &x1, &y1)) return;
+
+  float rdt = ar - br;
+  ar += 0.5;
+  float bax = bx - ax, bay = by - ay;
+
+  for (int32_t yp = y0; yp <= y1; yp++) {
+    for (int32_t xp = x0; xp <= x1; xp++) {
+      float alpha = ar - wedgeLineDistance(xp - ax, yp - ay, bax, bay, rdt);
+      if (alpha <= LoAlphaTheshold) continue;
+      if (alpha > HiAlphaTheshold) { d.drawPixel(xp, yp, fg_color); continue; }
+      uint16_t bg = (bg_color == 0x00FFFFFF) ? d.readPixel(xp, yp) : bg_color;
+      d.drawPixel(xp, yp, fastBlend((uint8_t)(alpha * PixelAlphaGain), fg_color, bg));
+    }
+  }
+}
+
+// Largest difference of the 5, 6 and 5 bit channels
+static int32_t channelDiff(uint16_t a, uint16_t b)
+{
+  int32_t r = abs((a >> 11) - (b >> 11));
+  int32_t g = abs(((a >> 5) & 0x3F) - ((b >> 5) & 0x3F));
+  int32_t l = abs((a & 0x1F) - (b & 0x1F));
+  return (r > g) ? (r > l ? r : l) : (g > l ? g : l);
+}
+
+static uint16_t pattern[TEST_W * TEST_H];
+static uint16_t drawn[TEST_W * TEST_H];
+static uint16_t exact[TEST_W * TEST_H];
+static uint16_t old[TEST_W * TEST_H];
+
+// Random blocks of colour, so read back backgrounds differ along an edge
+static void makePattern(void)
+{
+  uint16_t c = rnd(0x10000);
+  for (int32_t y = 0; y < TEST_H; y++) {
+    for (int32_t x = 0; x < TEST_W; x++) {
+      if (!rnd(6)) c = rnd(0x10000);
+      pattern[x + y * TEST_W] = (y & 4) ? c : (uint16_t)~c;
+    }
+  }
+}
+
+// Copy the pattern to, or the drawn area from, the TFT or Sprite, in RGB565 values
+static void put(bool sprite)
+{
+  if (sprite) {
+    uint16_t *p = (uint16_t *)spr.getPointer();
+    for (int32_t i = 0; i < TEST_W * TEST_H; i++) p[i] = pattern[i] << 8 | pattern[i] >> 8;
+  }
+  else {
+    uint16_t *fb = tft.framebuffer();
+    for (int32_t y = 0; y < TEST_H; y++) memcpy(fb + y * TFT_WIDTH, pattern + y * TEST_W, TEST_W * 2);
+  }
+}
+
+static void get(bool sprite, uint16_t *out)
+{
+  if (sprite) {
+    uint16_t *p = (uint16_t *)spr.getPointer();
+    for (int32_t i = 0; i < TEST_W * TEST_H; i++) out[i] = p[i] << 8 | p[i] >> 8;
+  }
+  else {
+    uint16_t *fb = tft.framebuffer();
+    for (int32_t y = 0; y < TEST_H; y++) memcpy(out + y * TEST_W, fb + y * TFT_WIDTH, TEST_W * 2);
+  }
+}
+
+static uint32_t worst = 0;  // Largest channel difference to the old code
+static uint32_t missed = 0; // Pixels the old code did not draw
+
+static bool runCase(uint32_t n)
+{
+  bool sprite = rnd(2);
+
+  // Wedges, wide lines and spots, partly off the test area now and then
+  float ax = rndf(-10, TEST_W + 10), ay = rndf(-10, TEST_H + 10);
+  float bx = ax + rndf(-60, 60), by = ay + rndf(-60, 60);
+  float ar = rndf(0, 12), br = rndf(0, 12);
+  switch (rnd(4)) {
+    case 0: br = ar; break;                  // Wide line
+    case 1: bx = ax; by = ay; br = ar; break; // Spot
+    case 2: br = rndf(0, 1.5f); break;        // Needle
+  }
+  if (!rnd(8)) { bx = ax + rndf(-1, 1); by = ay + rndf(-1, 1); }
+
+  uint32_t fg = rnd(0x10000);
+  uint32_t bg = rnd(2) ? 0x00FFFFFF : rnd(0x10000);
+
+  // Clip to a viewport without a datum offset now and then
+  bool vp = !rnd(3);
+  int32_t vx = rnd(TEST_W / 2), vy = rnd(TEST_H / 2);
+  int32_t vw = 1 + rnd(TEST_W - vx), vh = 1 + rnd(TEST_H - vy);
+
+  makePattern();
+
+  uint16_t *out[3] = { drawn, exact, old };
+  for (int pass = 0; pass < 3; pass++) {
+    put(sprite);
+    if (sprite) {
+      if (vp) spr.setViewport(vx, vy, vw, vh, false);
+      if (pass == 0) spr.drawWedgeLine(ax, ay, bx, by, ar, br, fg, bg);
+      if (pass == 1) allPixelsWedgeLine(spr, ax, ay, bx, by, ar, br, fg, bg);
+      if (pass == 2) oldWedgeLine(spr, ax, ay, bx, by, ar, br, fg, bg);
+      spr.resetViewport();
+    }
+    else {
+      if (vp) tft.setViewport(vx, vy, vw, vh, false);
+      else tft.setViewport(0, 0, TEST_W, TEST_H, false);
+      if (pass == 0) tft.drawWedgeLine(ax, ay, bx, by, ar, br, fg, bg);
+      if (pass == 1) allPixelsWedgeLine(tft, ax, ay, bx, by, ar, br, fg, bg);
+      if (pass == 2) oldWedgeLine(tft, ax, ay, bx, by, ar, br, fg, bg);
+      tft.resetViewport();
+    }
+    get(sprite, out[pass]);
+  }
+
+  for (int32_t i = 0; i < TEST_W * TEST_H; i++) {
+    const char *fail = nullptr;
+    uint32_t d = channelDiff(drawn[i], old[i]);
+    if (drawn[i] != exact[i]) fail = "every pixel evaluation";
+    else if (old[i] != pattern[i] || drawn[i] == pattern[i]) { // Not a pixel the old scan missed
+      if (d > worst) worst = d;
+      if (d > 1) fail = "old drawWedgeLine()";
+    }
+    else missed++;
+    if (fail) {
+      printf("case %u: %s (%.2f,%.2f)-(%.2f,%.2f) r %.2f,%.2f fg %04X bg %06X: pixel %d,%d is %04X, %s %04X\n",
+             n, sprite ? "Sprite" : "TFT", ax, ay, bx, by, ar, br, fg, bg,
+             i % TEST_W, i / TEST_W, drawn[i], fail, (drawn[i] != exact[i]) ? exact[i] : old[i]);
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t cases = (argc > 1) ? atoi(argv[1]) : 20000;
+  rng = (argc > 2) ? atoi(argv[2]) : 1;
+
+  tft.init();
+  spr.setColorDepth(16);
+  spr.createSprite(TEST_W, TEST_H);
+
+  uint32_t failed = 0;
+  for (uint32_t n = 0; n < cases; n++) {
+    if (!runCase(n) && ++failed >= 10) break;
+  }
+
+  printf("Wedge_Line_Test: %u cases, %u failed, largest difference to the old code %u LSB, %u pixels it missed\n",
+         cases, failed, worst, missed);
+  return failed ? 1 : 0;
+}
@@ -144,6 +144,8 @@
 //#include <User_Setups/Setup301_BW16_ST7735.h>            // Setup file for Bw16-based boards with ST7735 160 x 80 TFT
 //#include <User_Setups/Setup302_Waveshare_ESP32S3_GC9A01.h>            // Setup file for Waveshare ESP32-S3-Touch-LCD-1.28 board with GC9A01 240*240 TFT
 
+//#include <User_Setups/Setup500_Host_Framebuffer.h>  // Native host build, display modelled in memory (needs -DHOST_FRAMEBUFFER)
+
 //#include <User_Setups/SetupX_Template.h>     // Template file for a setup
 
 
@@ -0,0 +1,40 @@
+// Setup for the native host (Linux) framebuffer driver, see Processors/TFT_eSPI_Host.h
+// Models the GC9A01 240 x 240 display used by the CAN display panels.
+//
+// HOST_FRAMEBUFFER must be defined on the compiler command line (before TFT_eSPI.h is
+// read) so the Arduino headers are replaced by the host stand-ins.
+
+#define USER_SETUP_ID 500
+
+#if !defined (HOST_FRAMEBUFFER)
+  #error >>>>------>> Setup500 is for native host builds, compile with -DHOST_FRAMEBUFFER
+#endif
+
+// Build with -DHOST_ILI9341 to model an ILI9341 240 x 320 instead, which has no GC9A01
+// special cases in the drawing functions
+#if defined (HOST_ILI9341)
+  #define ILI9341_DRIVER
+#else
+  #define GC9A01_DRIVER
+#endif
+
+// Pin numbers are only reported by getSetup(), there is no hardware behind them
+#define TFT_MOSI 17
+#define TFT_SCLK 23
+#define TFT_CS   15
+#define TFT_DC   19
+#define TFT_RST  -1
+
+#define LOAD_GLCD   // Font 1. Original Adafruit 8 pixel font needs ~1820 bytes in FLASH
+#define LOAD_FONT2  // Font 2. Small 16 pixel high font, needs ~3534 bytes in FLASH, 96 characters
+#define LOAD_FONT4  // Font 4. Medium 26 pixel high font, needs ~5848 bytes in FLASH, 96 characters
+#define LOAD_FONT6  // Font 6. Large 48 pixel font, needs ~2666 bytes in FLASH, only characters 1234567890:-.apm
+#define LOAD_FONT7  // Font 7. 7 segment 48 pixel font, needs ~2438 bytes in FLASH, only characters 1234567890:.
+#define LOAD_FONT8  // Font 8. Large 75 pixel font needs ~3256 bytes in FLASH, only characters 1234567890:-.
+#define LOAD_GFXFF  // FreeFonts. Include access to the 48 Adafruit_GFX free fonts FF1 to FF48 and custom fonts
+#define SMOOTH_FONT
+
+// Used to estimate bus time from the bytes counted by busStats()
+#define SPI_FREQUENCY  40000000
+
+#define SPI_READ_FREQUENCY  20000000
@@ -0,0 +1,80 @@
+/*
+  Sketch to show a panel drawn by the TFT_eCompositor class.
+
+  Example for library:
+  https://github.com/Bodmer/TFT_eSPI
+
+  A full screen 240 x 240 16-bit Sprite needs 115 kbytes of RAM.
+  The compositor instead keeps a list of layers (rectangles,
+  Sprites, strings and callback functions) and draws the screen
+  16 rows at a time into a small band Sprite that is pushed to
+  the screen, so it only needs 240 * 16 * 2 = 7680 bytes however
+  many layers there are. Each band is drawn complete, so there is
+  no flicker.
+
+  Layers are drawn in the order they are added. A callback layer
+  can draw anything into the band, e.g. anti-aliased lines, using
+  the screen coordinates of the area.
+*/
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI tft = TFT_eSPI();
+
+TFT_eSprite     icon = TFT_eSprite(&tft); // Small Sprite shown as a layer
+TFT_eCompositor comp = TFT_eCompositor(&tft);
+
+float cellVolts[6] = { 3.6, 3.7, 3.8, 3.9, 4.0, 4.1 };
+float angle = 0;
+char  label[16] = "";
+
+// Draw the cell voltage bars, 3.0V to 4.2V
+void drawBars(TFT_eSprite *band, void *param)
+{
+  (void)param;
+  for (int i = 0; i < 6; i++) {
+    int h = (cellVolts[i] - 3.0) * 100;
+    band->fillRectVGradient(18 + i * 35, 180 - h, 29, h, TFT_GREEN, TFT_DARKGREEN);
+  }
+}
+
+// Draw a needle that sweeps round the centre of the screen
+void drawNeedle(TFT_eSprite *band, void *param)
+{
+  (void)param;
+  float x = 120 + 100 * cos(angle), y = 120 + 100 * sin(angle);
+  band->drawWedgeLine(120, 120, x, y, 6, 1, TFT_RED);
+}
+
+void setup()
+{
+  tft.init();
+  tft.fillScreen(TFT_BLACK);
+
+  // A yellow circle icon, black is transparent
+  icon.createSprite(30, 30);
+  icon.fillSprite(TFT_BLACK);
+  icon.fillCircle(15, 15, 13, TFT_YELLOW);
+
+  // 240 x 240 area, 16 row band
+  comp.begin(240, 240, 16);
+  comp.setBackground(TFT_NAVY);
+
+  comp.addRect(10, 190, 220, 40, TFT_DARKGREY);
+  comp.addLayer(drawBars, nullptr, 60, 120);           // Rows 60 to 179
+  comp.addSprite(&icon, 200, 10, TFT_BLACK);
+  comp.addString(label, 120, 210, 4, MC_DATUM, TFT_WHITE);
+  comp.addLayer(drawNeedle, nullptr, 0, 240);
+}
+
+void loop()
+{
+  for (int i = 0; i < 6; i++) {
+    cellVolts[i] += random(-10, 11) / 100.0;
+    cellVolts[i] = constrain(cellVolts[i], 3.0, 4.2);
+  }
+  angle += 0.05;
+  sprintf(label, "%.2f V", cellVolts[0] + cellVolts[1] + cellVolts[2]);
+
+  comp.render(0, 0);
+}
@@ -0,0 +1,59 @@
+#ifndef ARC_GAUGE_H
+#define ARC_GAUGE_H
+
+#include <stdint.h>
+
+class TFT_eSPI;
+
+// Ring meter around a value cell, e.g. SOC.
+// The value arc runs clockwise from startAngle to endAngle (0 = 6 o'clock) over
+// minValue..maxValue, on a track drawn with drawSmoothArc(). After the first
+// draw only the arc between the shown and the new value angle is painted, with
+// updateArc(), so an update costs the angle swept rather than a whole dial.
+// maxStep bounds the degrees painted per update and so the worst redraw time,
+// the gauge then catches up over the following updates.
+// The number itself is an ordinary value_cell of the same panel.
+class ArcGauge {
+public:
+    ArcGauge(const float& value, int16_t x, int16_t y, int16_t r, int16_t ir,
+             uint16_t startAngle, uint16_t endAngle, float minValue, float maxValue);
+
+    void     setColors(uint16_t fgColor, uint16_t trackColor, uint16_t bgColor);
+
+    // Degrees painted per update at most, 0 for no limit
+    void     setMaxStep(uint16_t degrees) { maxStep = degrees; }
+
+    // True if the gauge has to be drawn to show the current value
+    bool     pending() const;
+
+    // Draw the whole gauge the first time, then only the change. Returns the
+    // pixels pushed (estimated from the arc area). Call inside startWrite()/endWrite().
+    uint32_t draw(TFT_eSPI& tft);
+
+    // Whole gauge at the current value into a band sprite whose top is panel row y0.
+    // Call markDrawn() once every band is composed.
+    void     compose(TFT_eSPI& band, int16_t y0) const;
+    void     markDrawn();
+
+    // Repaint the whole gauge on the next draw, e.g. after a screen clear
+    void     invalidate() { drawn = false; }
+
+    int16_t  top() const    { return y - r - 1; }
+    int16_t  bottom() const { return y + r + 2; }
+
+private:
+    uint16_t targetOffset() const;
+    uint16_t angleAt(uint16_t offset) const;
+    uint32_t arcPixels(uint16_t degrees) const;
+
+    const float& value;
+    int16_t  x, y, r, ir;
+    uint16_t startAngle, sweep;  // Degrees clockwise from startAngle to endAngle
+    float    minValue, maxValue;
+    uint16_t fgColor, trackColor, bgColor;
+    uint16_t maxStep;
+    uint16_t shown;              // Offset from startAngle of the drawn value end
+    bool     drawn;
+};
+
+#endif // ARC_GAUGE_H
@@ -0,0 +1,38 @@
+#ifndef BAND_RENDERER_H
+#define BAND_RENDERER_H
+
+#include <stdint.h>
+#include "panel_layout.h"
+
+class TFT_eSPI;
+class TFT_eSprite;
+
+#define BAND_HEIGHT 16
+
+// Renders a panel layout in horizontal bands through two ping-pong sprites.
+// While one band is streamed out by pushImageDMA() the next band is composed
+// into the other sprite, so CPU rendering overlaps the SPI transfer.
+// Only bands touched by a changed cell are composed and sent.
+// Selected at boot by building with -D PANEL_RENDER_BANDS, the default is the glyph atlas.
+class BandRenderer {
+public:
+    BandRenderer(TFT_eSPI& tft);
+    ~BandRenderer();
+
+    // Allocate the band sprites and start the DMA engine, false on failure
+    bool     begin(int16_t width, int16_t height, int16_t bandHeight = BAND_HEIGHT);
+    bool     ready() const { return bands[0] != nullptr; }
+
+    // Draw the changed bands of a panel and return the number of pixels pushed.
+    // The panel must already be selected and inside startWrite()/endWrite().
+    uint32_t drawPanel(panel_layout& panel);
+
+private:
+    void     composeBand(const panel_layout& panel, TFT_eSprite& band, int16_t y0);
+
+    TFT_eSPI&    tft;
+    TFT_eSprite* bands[2];
+    int16_t      width, height, bandHeight;
+};
+
+#endif // BAND_RENDERER_H
@@ -0,0 +1,53 @@
+#ifndef CAN_DECODER_H
+#define CAN_DECODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Structure for received CAN message
+typedef struct struct_message {
+    unsigned long canId;
+    uint8_t len;
+    uint8_t data[8];
+} struct_message;
+
+// Structure for display data
+typedef struct display_data {
+    float vcell[16]; // Vcell1-16
+    float voltT, a;  // From 2214625280
+    float t[4];      // T1-T4
+    float s6;        // Only S6 (labeled as SOC)
+} display_data;
+
+#define SIG_BIG_ENDIAN    0
+#define SIG_LITTLE_ENDIAN 1
+
+// One signal inside a CAN frame: value = raw * scale + offset
+typedef struct can_signal {
+    uint8_t  start;   // Byte offset in the frame data
+    uint8_t  width;   // Width in bytes (1-4)
+    uint8_t  endian;  // SIG_BIG_ENDIAN or SIG_LITTLE_ENDIAN
+    uint16_t field;   // Byte offset of the destination float in display_data
+    float    scale;
+    float    offset;
+} can_signal;
+
+// One CAN ID and the slice of the signal table it owns
+typedef struct can_message {
+    uint32_t canId;
+    uint8_t  first;   // Index of first signal
+    uint8_t  count;   // Number of signals
+} can_message;
+
+// Decode a frame into data, returns false if the CAN ID is not in the table.
+// Signals that do not fit inside frame.len are left untouched.
+bool decodeCanFrame(const struct_message& frame, display_data& data);
+
+// Look up a CAN ID in the message table, returns nullptr if unknown
+const can_message* findCanMessage(uint32_t canId);
+
+// Table access (mainly for host-side testing)
+const can_signal*  canSignalTable(size_t* count);
+const can_message* canMessageTable(size_t* count);
+
+#endif // CAN_DECODER_H
@@ -0,0 +1,57 @@
+#ifndef DIGIT_ATLAS_H
+#define DIGIT_ATLAS_H
+
+#include <stdint.h>
+#include "panel_layout.h"
+
+class TFT_eSPI;
+
+#define ATLAS_GLYPHS     "0123456789.- "
+#define ATLAS_MAX_FACES  4
+#define ATLAS_MAX_LABELS 32
+#define ATLAS_MAX_WIDTH  240   // Widest cell in pixels, sizes the row buffer
+
+// Pre-rendered GLCD font tiles for "label value" cells.
+// Digits, '.', '-' and ' ' are rasterised once per text size and colour pair
+// into an RGB565 strip, each cell label once into a 1-bit mask. A cell is then
+// drawn as a single address window, one composed row at a time, instead of
+// drawChar() plotting every glyph pixel.
+class DigitAtlas {
+public:
+    DigitAtlas(TFT_eSPI& tft);
+    ~DigitAtlas();
+
+    // Draw a cell's current text middle-centre at (x, y), padded to padWidth
+    // like drawString() with setTextPadding(). Returns the pixels pushed, or 0
+    // if the text has characters outside the atlas or memory ran out, in which
+    // case nothing was drawn. Call inside startWrite()/endWrite().
+    uint32_t drawCell(const value_cell& cell, uint16_t fgColor, uint16_t bgColor, int16_t padWidth);
+
+    // Free every face and label
+    void     clear();
+
+private:
+    typedef struct atlas_face {
+        uint8_t   size;
+        uint16_t  fgColor, bgColor;
+        uint16_t* strip;      // ATLAS_GLYPHS side by side, panel byte order
+    } atlas_face;
+
+    typedef struct atlas_label {
+        const char* label;    // Cell label pointer, labels are string literals
+        uint8_t     face;
+        uint8_t*    mask;     // "label " as 1 bit per pixel, rows padded to bytes
+    } atlas_label;
+
+    int8_t   findFace(uint8_t size, uint16_t fgColor, uint16_t bgColor);
+    int8_t   findLabel(const char* label, uint8_t face);
+
+    // pushPixels() reads the row 32 bits at a time on ESP32, unaligned loads fault
+    alignas(4) uint16_t row[ATLAS_MAX_WIDTH];
+    TFT_eSPI&   tft;
+    atlas_face  faces[ATLAS_MAX_FACES];
+    atlas_label labels[ATLAS_MAX_LABELS];
+    uint8_t     faceCount, labelCount;
+};
+
+#endif // DIGIT_ATLAS_H
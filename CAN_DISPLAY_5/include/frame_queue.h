@@ -0,0 +1,70 @@
+#ifndef FRAME_QUEUE_H
+#define FRAME_QUEUE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Keep producer and consumer indices on separate cache lines
+#ifndef FRAME_QUEUE_ALIGN
+#define FRAME_QUEUE_ALIGN 64
+#endif
+
+// Fixed-capacity single-producer / single-consumer queue.
+// push() must only be called from one context (the ESP-NOW receive callback)
+// and pop() from one other context (loop()). No locks, no heap.
+// CAPACITY must be a power of 2.
+template <typename T, size_t CAPACITY>
+class FrameQueue {
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of 2");
+
+public:
+    FrameQueue() : head(0), dropped(0), highWater(0), tail(0) {}
+
+    // Producer side: copy item into the queue, returns false (and counts a drop) if full
+    bool push(const T& item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t t = tail.load(std::memory_order_acquire);
+        uint32_t used = h - t;
+        if (used >= CAPACITY) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        slots[h & (CAPACITY - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        if (used + 1 > highWater.load(std::memory_order_relaxed)) highWater.store(used + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Consumer side: copy oldest item out, returns false if empty
+    bool pop(T& item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+        if (h == t) return false;
+        item = slots[t & (CAPACITY - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called from the producer side
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+    bool   empty() const { return size() == 0; }
+    static constexpr size_t capacity() { return CAPACITY; }
+
+    // Statistics, written by the producer only and never reset. Counts are since
+    // construction, a reader keeps its own snapshot to report the change.
+    uint32_t droppedCount()   const { return dropped.load(std::memory_order_relaxed); }
+    uint32_t highWaterMark()  const { return highWater.load(std::memory_order_relaxed); }
+    uint32_t pushedCount()    const { return head.load(std::memory_order_relaxed); }
+
+private:
+    alignas(FRAME_QUEUE_ALIGN) std::atomic<uint32_t> head;      // Written by producer only
+    std::atomic<uint32_t> dropped;                               // Written by producer only
+    std::atomic<uint32_t> highWater;                             // Written by producer only
+    alignas(FRAME_QUEUE_ALIGN) std::atomic<uint32_t> tail;      // Written by consumer only
+    alignas(FRAME_QUEUE_ALIGN) T slots[CAPACITY];
+};
+
+#endif // FRAME_QUEUE_H
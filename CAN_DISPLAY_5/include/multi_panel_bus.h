@@ -0,0 +1,80 @@
+#ifndef MULTI_PANEL_BUS_H
+#define MULTI_PANEL_BUS_H
+
+#include <stdint.h>
+#include "panel_layout.h"
+
+class TFT_eSPI;
+class BandRenderer;
+class DigitAtlas;
+
+#define MAX_PANELS 8
+
+// Per-panel transfer statistics
+typedef struct panel_stats {
+    uint32_t frameTimeUs;     // Duration of the last transaction
+    uint32_t maxFrameTimeUs;  // Worst transaction since reset
+    uint32_t bytesOnWire;     // Pixel bytes sent by the last transaction (RGB565)
+    uint32_t totalBytes;      // Pixel bytes sent since reset
+    uint32_t frames;          // Transactions since reset
+} panel_stats;
+
+// Several panels sharing one TFT_eSPI bus, each selected by its own CS pin.
+// All pending draws for a panel go out in a single CS-asserted transaction
+// and dirty panels are serviced oldest-first.
+class MultiPanelBus {
+public:
+    MultiPanelBus(TFT_eSPI& tft);
+
+    // Register a panel, returns its index or -1 if the bus is full
+    int8_t  addPanel(int csPin, panel_layout* layout);
+
+    // Configure CS pins and queue a full clear of every panel
+    void    begin();
+
+    // Re-format every panel layout and mark those with changed cells as dirty
+    uint8_t refresh();
+
+    // Draw up to maxPanels dirty panels, stalest first, each at most once per call.
+    // Returns the number drawn.
+    uint8_t service(uint8_t maxPanels = MAX_PANELS);
+
+    void    invalidate(uint8_t panel);
+
+    // Draw through a DMA band pipeline instead of blocking drawString calls, nullptr to revert
+    void    setRenderer(BandRenderer* renderer) { bandRenderer = renderer; }
+
+    // Draw cells from pre-rendered glyph tiles when no band renderer is set, nullptr to revert
+    void    setAtlas(DigitAtlas* digitAtlas) { atlas = digitAtlas; }
+
+    uint8_t panelCount() const { return count; }
+    bool    isDirty(uint8_t panel) const { return panels[panel].dirty; }
+    const panel_stats& stats(uint8_t panel) const { return panels[panel].stats; }
+    // Bus time of the last service() call that drew a panel, and the worst since reset
+    uint32_t lastServiceUs() const { return serviceTimeUs; }
+    uint32_t maxServiceUs() const { return maxServiceTimeUs; }
+    void    resetStats();
+
+private:
+    typedef struct panel_slot {
+        int           csPin;
+        panel_layout* layout;
+        bool          dirty;
+        uint32_t      lastServiced; // millis() of last transaction
+        panel_stats   stats;
+    } panel_slot;
+
+    void    select(uint8_t panel);
+    void    deselect(uint8_t panel);
+    int8_t  stalestDirty(uint32_t now, uint16_t due) const;
+
+    TFT_eSPI&     tft;
+    BandRenderer* bandRenderer;
+    DigitAtlas*   atlas;
+    panel_slot    panels[MAX_PANELS];
+    uint8_t       count;
+    uint32_t      serviceTimeUs;
+    uint32_t      maxServiceTimeUs;
+};
+
+#endif // MULTI_PANEL_BUS_H
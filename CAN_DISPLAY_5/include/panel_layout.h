@@ -0,0 +1,50 @@
+#ifndef PANEL_LAYOUT_H
+#define PANEL_LAYOUT_H
+
+#include <stdint.h>
+
+class TFT_eSPI;
+class DigitAtlas;
+class ArcGauge;
+class StripChart;
+
+#define CELL_TEXT_LEN 20
+
+// One "label value" text cell, drawn middle-centre at (x, y)
+typedef struct value_cell {
+    const char*  label;
+    const float* value;          // Points into display_data
+    int16_t      x, y;
+    uint8_t      size;           // GLCD text size
+    char         text[CELL_TEXT_LEN]; // Latest formatted string
+    int16_t      width;          // Pixel width currently covered on the panel
+    bool         changed;        // text differs from what is on the panel
+} value_cell;
+
+// Retained-mode layout of one panel: only cells whose string changed are repainted
+typedef struct panel_layout {
+    value_cell*  cells;
+    uint8_t      count;
+    uint16_t     bgColor;
+    uint16_t     fgColor;
+    bool         cleared;        // Screen has been cleared since power up
+    uint32_t     pixelsPushed;   // Pixels written by the last drawPanel()
+    ArcGauge*    gauge;          // Optional ring meter, nullptr if none
+    StripChart*  chart;          // Optional strip chart, nullptr if none
+    bool         pending;        // Left out of the last draw, e.g. a gauge limited by its maxStep
+} panel_layout;
+
+#define VALUE_CELL(label, value, x, y, size) { label, &(value), x, y, size, "", 0, true }
+
+// Re-format every cell, returns true if anything needs drawing
+bool refreshPanel(panel_layout& panel);
+
+// Draw the changed cells, any gauge change and new chart rows and return the number of pixels
+// pushed, through the atlas when given (drawString() for any cell it cannot draw).
+// The panel must already be selected and inside startWrite()/endWrite().
+uint32_t drawPanel(TFT_eSPI& tft, panel_layout& panel, DigitAtlas* atlas = nullptr);
+
+// Force a screen clear and every cell, gauge and chart to be repainted on the next draw
+void invalidatePanel(panel_layout& panel);
+
+#endif // PANEL_LAYOUT_H
@@ -0,0 +1,78 @@
+#ifndef STRIP_CHART_H
+#define STRIP_CHART_H
+
+#include <stdint.h>
+
+class TFT_eSPI;
+
+#define CHART_MAX_TRACES 17    // 16 cell voltages and the pack current
+#define CHART_MAX_ROWS   160   // Samples kept, one per row
+#define CHART_MAX_WIDTH  240   // Widest chart in pixels, sizes the row buffer
+
+// Strip chart of a few values, one row per sample(). Values run across the
+// chart, time runs down the panel's scan lines: the newest sample is the bottom
+// row and older ones move up. Each value is a trace joined to its previous
+// sample.
+// Rows are a ring in display RAM at fixed positions and the controller's
+// hardware vertical scrolling rotates the oldest one to the top, so a sample
+// costs one row of pixels and a scroll command rather than the whole chart.
+// The scroll area spans the full panel width, so no cell may share its rows.
+// Without scroll support the whole chart is redrawn for each sample.
+class StripChart {
+public:
+    StripChart(int16_t x, int16_t y, int16_t width, int16_t rows);
+
+    // Plot value from minValue (left) to maxValue (right), false if the chart is full
+    bool     addTrace(const float& value, float minValue, float maxValue, uint16_t color);
+    void     setBackground(uint16_t color) { bgColor = color; drawn = false; }
+
+    // Record the current value of every trace as the newest row
+    void     sample();
+
+    // True if samples, or the scroll position, still have to go to the panel
+    bool     pending() const;
+
+    // Draw the new rows and scroll them into view, the whole chart the first time.
+    // Returns the pixels pushed. Call inside startWrite()/endWrite().
+    uint32_t draw(TFT_eSPI& tft);
+
+    // Rows of the chart, in display RAM order, into a band sprite whose top is
+    // panel row y0. Call markDrawn() if the bands covered the whole chart, then
+    // draw() to send anything left and set the scroll position.
+    void     compose(TFT_eSPI& band, int16_t y0) const;
+    void     markDrawn();
+
+    // Set up scrolling and repaint the whole chart on the next draw, e.g. after a screen clear
+    void     invalidate();
+
+    int16_t  top() const    { return y; }
+    int16_t  bottom() const { return y + rows; }
+
+private:
+    typedef struct chart_trace {
+        const float* value;
+        float        minValue;
+        float        scale;      // Pixels per unit
+        uint16_t     color;
+    } chart_trace;
+
+    int16_t  slotAt(int16_t row) const;
+    bool     traceSpan(int16_t slot, uint8_t trace, int16_t* xs, int16_t* len) const;
+    void     drawRow(TFT_eSPI& tft, int16_t slot, int16_t row);
+
+    chart_trace traces[CHART_MAX_TRACES];
+    uint8_t  traceCount;
+    int16_t  x, y, width, rows;
+    uint16_t bgColor;
+    uint8_t  xs[CHART_MAX_ROWS][CHART_MAX_TRACES]; // Trace x in each ring slot, 0xFF if no value
+    int16_t  head;         // Slot of the newest sample, slot s lives in display RAM row y + s
+    int16_t  filled;       // Slots holding a sample
+    int16_t  undrawn;      // Newest samples not yet on the panel
+    int16_t  shownHead;    // head when the scroll position was last sent, -1 if unknown
+    bool     drawn;        // Every filled slot is on the panel
+    bool     scrollSet;    // Scroll area sent since invalidate()
+    bool     hwScroll;     // The display scrolls, else rows are redrawn oldest first
+    uint16_t row[CHART_MAX_WIDTH];
+};
+
+#endif // STRIP_CHART_H
@@ -0,0 +1,77 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "arc_gauge.h"
+
+ArcGauge::ArcGauge(const float& value, int16_t x, int16_t y, int16_t r, int16_t ir,
+                   uint16_t startAngle, uint16_t endAngle, float minValue, float maxValue)
+    : value(value), x(x), y(y), r(r), ir(ir), startAngle(startAngle % 360),
+      minValue(minValue), maxValue(maxValue), fgColor(TFT_GREEN), trackColor(TFT_DARKGREY),
+      bgColor(TFT_BLACK), maxStep(0), shown(0), drawn(false) {
+    endAngle %= 360;
+    sweep = endAngle > this->startAngle ? endAngle - this->startAngle : endAngle + 360 - this->startAngle;
+}
+
+void ArcGauge::setColors(uint16_t fg, uint16_t track, uint16_t bg) {
+    fgColor = fg;
+    trackColor = track;
+    bgColor = bg;
+    drawn = false;
+}
+
+bool ArcGauge::pending() const {
+    return !drawn || shown != targetOffset();
+}
+
+uint32_t ArcGauge::draw(TFT_eSPI& tft) {
+    uint16_t target = targetOffset();
+
+    if (!drawn) {
+        // Track with anti-aliased ends, then the value arc over it
+        tft.drawSmoothArc(x, y, r, ir, startAngle, angleAt(sweep), trackColor, bgColor);
+        if (target) tft.drawArc(x, y, r, ir, startAngle, angleAt(target), fgColor, bgColor);
+        shown = target;
+        drawn = true;
+        return arcPixels(sweep);
+    }
+
+    if (target == shown) return 0;
+    if (maxStep) {
+        if (target > shown + maxStep) target = shown + maxStep;
+        else if (target + maxStep < shown) target = shown - maxStep;
+    }
+
+    tft.updateArc(x, y, r, ir, startAngle, angleAt(shown), angleAt(target), fgColor, trackColor, bgColor);
+    uint16_t swept = target > shown ? target - shown : shown - target;
+    shown = target;
+    return arcPixels(swept);
+}
+
+void ArcGauge::compose(TFT_eSPI& band, int16_t y0) const {
+    if (bottom() <= y0 || top() >= y0 + band.height()) return;
+    uint16_t target = targetOffset();
+    band.drawSmoothArc(x, y - y0, r, ir, startAngle, angleAt(sweep), trackColor, bgColor);
+    if (target) band.drawArc(x, y - y0, r, ir, startAngle, angleAt(target), fgColor, bgColor);
+}
+
+void ArcGauge::markDrawn() {
+    shown = targetOffset();
+    drawn = true;
+}
+
+// Degrees from startAngle for the current value, clamped to the scale
+uint16_t ArcGauge::targetOffset() const {
+    float v = value;
+    if (!(v > minValue)) return 0; // Also NaN
+    if (v >= maxValue) return sweep;
+    return (uint16_t)((v - minValue) * sweep / (maxValue - minValue) + 0.5f);
+}
+
+// drawArc() angle for an offset, 1-360 so a full circle end is not 0
+uint16_t ArcGauge::angleAt(uint16_t offset) const {
+    uint16_t angle = startAngle + offset;
+    return angle > 360 ? angle - 360 : angle;
+}
+
+uint32_t ArcGauge::arcPixels(uint16_t degrees) const {
+    return (uint32_t)(((int32_t)r * r - (int32_t)ir * ir) * PI * degrees / 360);
+}
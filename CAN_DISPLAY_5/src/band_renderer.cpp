@@ -0,0 +1,126 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "band_renderer.h"
+#include "arc_gauge.h"
+#include "strip_chart.h"
+
+BandRenderer::BandRenderer(TFT_eSPI& tft) : tft(tft), width(0), height(0), bandHeight(0) {
+    bands[0] = bands[1] = nullptr;
+}
+
+BandRenderer::~BandRenderer() {
+    for (uint8_t i = 0; i < 2; i++) {
+        if (bands[i]) {
+            bands[i]->deleteSprite();
+            delete bands[i];
+        }
+    }
+}
+
+bool BandRenderer::begin(int16_t w, int16_t h, int16_t bandH) {
+    if (ready()) return true;
+    width = w;
+    height = h;
+    bandHeight = bandH;
+
+    for (uint8_t i = 0; i < 2; i++) {
+        bands[i] = new TFT_eSprite(&tft);
+        bands[i]->setColorDepth(16);
+        if (!bands[i]->createSprite(width, bandHeight)) {
+            for (uint8_t j = 0; j <= i; j++) {
+                delete bands[j];
+                bands[j] = nullptr;
+            }
+            return false;
+        }
+    }
+
+    // Without DMA pushImageDMA() sends nothing, so the caller must draw another way
+    if (!tft.DMA_Enabled && !tft.initDMA()) {
+        for (uint8_t i = 0; i < 2; i++) {
+            delete bands[i];
+            bands[i] = nullptr;
+        }
+        return false;
+    }
+
+    // Sprite pixels are already stored in panel byte order
+    tft.setSwapBytes(false);
+    return true;
+}
+
+uint32_t BandRenderer::drawPanel(panel_layout& panel) {
+    if (!ready()) return 0;
+
+    // Rows covered by changed cells, or the whole panel on the first pass
+    int16_t top = 0, bottom = height;
+    if (panel.cleared) {
+        top = height;
+        bottom = 0;
+        for (uint8_t i = 0; i < panel.count; i++) {
+            const value_cell& cell = panel.cells[i];
+            if (!cell.changed) continue;
+            int16_t half = 4 * cell.size;
+            if (cell.y - half < top) top = cell.y - half;
+            if (cell.y + half > bottom) bottom = cell.y + half;
+        }
+        ArcGauge* gauge = panel.gauge;
+        if (gauge && gauge->pending()) {
+            if (gauge->top() < top) top = gauge->top();
+            if (gauge->bottom() > bottom) bottom = gauge->bottom();
+        }
+        if (top < 0) top = 0;
+        if (bottom > height) bottom = height;
+        if (top >= bottom && !(panel.chart && panel.chart->pending())) return 0;
+    }
+
+    // New chart rows are not composed, the chart sends them itself after the bands
+    uint32_t pixels = 0;
+    uint8_t  next = 0;
+    for (int16_t y0 = (top / bandHeight) * bandHeight; y0 < bottom; y0 += bandHeight) {
+        int16_t h = bandHeight;
+        if (y0 + h > height) h = height - y0;
+
+        // The DMA using this sprite finished before the other one was queued
+        TFT_eSprite& band = *bands[next];
+        composeBand(panel, band, y0);
+        tft.pushImageDMA(0, y0, width, h, (uint16_t*)band.getPointer());
+        pixels += (uint32_t)width * h;
+        next ^= 1;
+    }
+    tft.dmaWait();
+
+    for (uint8_t i = 0; i < panel.count; i++) {
+        value_cell& cell = panel.cells[i];
+        if (!cell.changed) continue;
+        tft.setTextSize(cell.size);
+        cell.width = tft.textWidth(cell.text);
+        cell.changed = false;
+    }
+    if (panel.gauge) panel.gauge->markDrawn();
+    if (panel.chart) {
+        if (top <= panel.chart->top() && bottom >= panel.chart->bottom()) panel.chart->markDrawn();
+        pixels += panel.chart->draw(tft);
+    }
+    panel.cleared = true;
+    panel.pending = false;
+    panel.pixelsPushed = pixels;
+    return pixels;
+}
+
+// Draw every cell overlapping rows y0 to y0 + bandHeight, and any gauge and chart, into the band sprite
+void BandRenderer::composeBand(const panel_layout& panel, TFT_eSprite& band, int16_t y0) {
+    band.fillSprite(panel.bgColor);
+    band.setTextColor(panel.fgColor, panel.bgColor);
+    band.setTextDatum(MC_DATUM);
+
+    for (uint8_t i = 0; i < panel.count; i++) {
+        const value_cell& cell = panel.cells[i];
+        int16_t half = 4 * cell.size;
+        if (cell.y + half <= y0 || cell.y - half >= y0 + bandHeight) continue;
+        band.setTextSize(cell.size);
+        band.drawString(cell.text, cell.x, cell.y - y0);
+    }
+    if (panel.gauge) panel.gauge->compose(band, y0);
+    if (panel.chart) panel.chart->compose(band, y0);
+}
@@ -0,0 +1,114 @@
+#include "can_decoder.h"
+#include <string.h>
+
+#define SIG_FIELD(member) ((uint16_t)offsetof(display_data, member))
+
+// Signal table, grouped by CAN ID in the same order as canMessages[]
+static constexpr can_signal canSignals[] = {
+    // 0x84008000 : pack voltage and current
+    { 0, 2, SIG_BIG_ENDIAN, SIG_FIELD(voltT),     0.1f,          0.0f },
+    { 2, 2, SIG_BIG_ENDIAN, SIG_FIELD(a),         0.1f,      -3000.0f },
+    // 0x84028000 : SOC in bytes 5-6
+    { 5, 2, SIG_BIG_ENDIAN, SIG_FIELD(s6),        1.0f / 160.0f, 0.0f },
+    // 0x88008000 - 0x88038000 : cell voltages in mV, 4 cells per frame
+    { 0, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[0]),  0.001f,        0.0f },
+    { 2, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[1]),  0.001f,        0.0f },
+    { 4, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[2]),  0.001f,        0.0f },
+    { 6, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[3]),  0.001f,        0.0f },
+    { 0, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[4]),  0.001f,        0.0f },
+    { 2, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[5]),  0.001f,        0.0f },
+    { 4, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[6]),  0.001f,        0.0f },
+    { 6, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[7]),  0.001f,        0.0f },
+    { 0, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[8]),  0.001f,        0.0f },
+    { 2, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[9]),  0.001f,        0.0f },
+    { 4, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[10]), 0.001f,        0.0f },
+    { 6, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[11]), 0.001f,        0.0f },
+    { 0, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[12]), 0.001f,        0.0f },
+    { 2, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[13]), 0.001f,        0.0f },
+    { 4, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[14]), 0.001f,        0.0f },
+    { 6, 2, SIG_BIG_ENDIAN, SIG_FIELD(vcell[15]), 0.001f,        0.0f },
+    // 0x90008000 : temperatures, 1 byte each with -40 offset
+    { 0, 1, SIG_BIG_ENDIAN, SIG_FIELD(t[0]),      1.0f,        -40.0f },
+    { 1, 1, SIG_BIG_ENDIAN, SIG_FIELD(t[1]),      1.0f,        -40.0f },
+    { 2, 1, SIG_BIG_ENDIAN, SIG_FIELD(t[2]),      1.0f,        -40.0f },
+    { 3, 1, SIG_BIG_ENDIAN, SIG_FIELD(t[3]),      1.0f,        -40.0f },
+};
+
+// Message table, must be sorted by ascending CAN ID for the binary search
+static constexpr can_message canMessages[] = {
+    { 0x84008000,  0, 2 }, // 2214625280
+    { 0x84028000,  2, 1 }, // 2214756352
+    { 0x88008000,  3, 4 }, // 2281734144
+    { 0x88018000,  7, 4 }, // 2281799680
+    { 0x88028000, 11, 4 }, // 2281865216
+    { 0x88038000, 15, 4 }, // 2281930752
+    { 0x90008000, 19, 4 }, // 2415951872
+};
+
+#define NUM_SIGNALS  (sizeof(canSignals)  / sizeof(canSignals[0]))
+#define NUM_MESSAGES (sizeof(canMessages) / sizeof(canMessages[0]))
+
+// Compile time checks so a bad table edit fails the build rather than the decode
+static constexpr bool messagesSorted(size_t i) {
+    return i + 1 >= NUM_MESSAGES ? true :
+           (canMessages[i].canId < canMessages[i + 1].canId) && messagesSorted(i + 1);
+}
+static constexpr bool messagesCoverSignals(size_t i, size_t next) {
+    return i >= NUM_MESSAGES ? next == NUM_SIGNALS :
+           canMessages[i].first == next && messagesCoverSignals(i + 1, next + canMessages[i].count);
+}
+static constexpr bool signalsValid(size_t i) {
+    return i >= NUM_SIGNALS ? true :
+           canSignals[i].width >= 1 && canSignals[i].width <= 4 &&
+           canSignals[i].start + canSignals[i].width <= 8 &&
+           canSignals[i].field + sizeof(float) <= sizeof(display_data) &&
+           signalsValid(i + 1);
+}
+static_assert(messagesSorted(0), "canMessages[] must be sorted by CAN ID");
+static_assert(messagesCoverSignals(0, 0), "canMessages[] slices must cover canSignals[] in order");
+static_assert(signalsValid(0), "canSignals[] entry out of range");
+
+const can_message* findCanMessage(uint32_t canId) {
+    size_t lo = 0, hi = NUM_MESSAGES;
+    while (lo < hi) {
+        size_t mid = (lo + hi) >> 1;
+        if (canMessages[mid].canId < canId) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < NUM_MESSAGES && canMessages[lo].canId == canId) return &canMessages[lo];
+    return nullptr;
+}
+
+bool decodeCanFrame(const struct_message& frame, display_data& data) {
+    const can_message* msg = findCanMessage((uint32_t)frame.canId);
+    if (!msg) return false;
+
+    uint8_t len = frame.len > 8 ? 8 : frame.len;
+    const can_signal* sig = &canSignals[msg->first];
+    for (uint8_t n = 0; n < msg->count; n++, sig++) {
+        if (sig->start + sig->width > len) continue;
+
+        uint32_t raw = 0;
+        const uint8_t* p = &frame.data[sig->start];
+        if (sig->endian == SIG_BIG_ENDIAN) {
+            for (uint8_t i = 0; i < sig->width; i++) raw = (raw << 8) | p[i];
+        }
+        else {
+            for (uint8_t i = sig->width; i > 0; i--) raw = (raw << 8) | p[i - 1];
+        }
+
+        float value = (float)raw * sig->scale + sig->offset;
+        memcpy((uint8_t*)&data + sig->field, &value, sizeof(float));
+    }
+    return true;
+}
+
+const can_signal* canSignalTable(size_t* count) {
+    if (count) *count = NUM_SIGNALS;
+    return canSignals;
+}
+
+const can_message* canMessageTable(size_t* count) {
+    if (count) *count = NUM_MESSAGES;
+    return canMessages;
+}
@@ -0,0 +1,163 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "digit_atlas.h"
+
+#define ATLAS_GLYPH_COUNT (sizeof(ATLAS_GLYPHS) - 1)
+
+DigitAtlas::DigitAtlas(TFT_eSPI& tft) : tft(tft), faceCount(0), labelCount(0) {
+    // The tft reference makes the class non-standard-layout, offsetof() still works
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+    static_assert(offsetof(DigitAtlas, row) % 4 == 0, "DigitAtlas::row must be 32-bit aligned");
+#pragma GCC diagnostic pop
+    memset(faces, 0, sizeof(faces));
+    memset(labels, 0, sizeof(labels));
+}
+
+DigitAtlas::~DigitAtlas() {
+    clear();
+}
+
+void DigitAtlas::clear() {
+    for (uint8_t i = 0; i < faceCount; i++) free(faces[i].strip);
+    for (uint8_t i = 0; i < labelCount; i++) free(labels[i].mask);
+    memset(faces, 0, sizeof(faces));
+    memset(labels, 0, sizeof(labels));
+    faceCount = labelCount = 0;
+}
+
+uint32_t DigitAtlas::drawCell(const value_cell& cell, uint16_t fgColor, uint16_t bgColor, int16_t padWidth) {
+    // Text is "label value", only the value part comes from the glyph strip
+    size_t labelLen = strlen(cell.label);
+    if (strncmp(cell.text, cell.label, labelLen) != 0 || cell.text[labelLen] != ' ') return 0;
+    const char* digits = cell.text + labelLen + 1;
+
+    uint8_t glyph[CELL_TEXT_LEN];
+    uint8_t digitCount = 0;
+    for (const char* p = digits; *p; p++) {
+        const char* g = strchr(ATLAS_GLYPHS, *p);
+        if (!g) return 0; // e.g. "nan"
+        glyph[digitCount++] = g - ATLAS_GLYPHS;
+    }
+
+    uint8_t size   = cell.size;
+    int16_t charW  = 6 * size;
+    int16_t height = 8 * size;
+    int16_t labelW = (labelLen + 1) * charW;
+    int16_t textW  = labelW + digitCount * charW;
+
+    // Same placement as drawString() with MC_DATUM and padding
+    int16_t side  = padWidth > textW ? (padWidth - textW) >> 1 : 0;
+    int16_t width = textW + 2 * side;
+    int16_t x0    = cell.x - textW / 2 - side;
+    int16_t y0    = cell.y - height / 2;
+    if (width > ATLAS_MAX_WIDTH || x0 < 0 || y0 < 0 || x0 + width > tft.width() || y0 + height > tft.height()) return 0;
+
+    int8_t face = findFace(size, fgColor, bgColor);
+    if (face < 0) return 0;
+    int8_t label = findLabel(cell.label, face);
+    if (label < 0) return 0;
+
+    const uint16_t* strip = faces[face].strip;
+    const uint8_t*  mask  = labels[label].mask;
+    uint16_t stripW = ATLAS_GLYPH_COUNT * charW;
+    uint16_t maskW  = (labelW + 7) >> 3;
+    uint16_t fg = fgColor << 8 | fgColor >> 8; // Panel byte order, as in the sprite strip
+    uint16_t bg = bgColor << 8 | bgColor >> 8;
+
+    bool swap = tft.getSwapBytes();
+    tft.setSwapBytes(false);
+    tft.setAddrWindow(x0, y0, width, height);
+
+    for (int16_t y = 0; y < height; y++) {
+        uint16_t* out = row;
+        for (int16_t i = 0; i < side; i++) *out++ = bg;
+
+        const uint8_t* bits = mask + y * maskW;
+        for (int16_t x = 0; x < labelW; x++) *out++ = (bits[x >> 3] & (0x80 >> (x & 7))) ? fg : bg;
+
+        const uint16_t* tiles = strip + y * stripW;
+        for (uint8_t i = 0; i < digitCount; i++) {
+            memcpy(out, tiles + glyph[i] * charW, charW * sizeof(uint16_t));
+            out += charW;
+        }
+
+        for (int16_t i = 0; i < side; i++) *out++ = bg;
+        tft.pushPixels(row, width);
+    }
+
+    tft.setSwapBytes(swap);
+    return (uint32_t)width * height;
+}
+
+// Face for a size and colour pair, rasterised with drawChar() on first use
+int8_t DigitAtlas::findFace(uint8_t size, uint16_t fgColor, uint16_t bgColor) {
+    for (uint8_t i = 0; i < faceCount; i++) {
+        const atlas_face& f = faces[i];
+        if (f.size == size && f.fgColor == fgColor && f.bgColor == bgColor) return i;
+    }
+    if (faceCount >= ATLAS_MAX_FACES) return -1;
+
+    int16_t charW = 6 * size;
+    int16_t w = ATLAS_GLYPH_COUNT * charW;
+    int16_t h = 8 * size;
+
+    // 16-bit sprites hold pixels in panel byte order, ready for pushPixels()
+    TFT_eSprite spr(&tft);
+    spr.setColorDepth(16);
+    if (!spr.createSprite(w, h)) return -1;
+    for (uint8_t i = 0; i < ATLAS_GLYPH_COUNT; i++) {
+        spr.drawChar(i * charW, 0, ATLAS_GLYPHS[i], fgColor, bgColor, size);
+    }
+
+    uint16_t* strip = (uint16_t*)malloc((uint32_t)w * h * sizeof(uint16_t));
+    if (strip) memcpy(strip, spr.getPointer(), (uint32_t)w * h * sizeof(uint16_t));
+    spr.deleteSprite();
+    if (!strip) return -1;
+
+    atlas_face& f = faces[faceCount];
+    f.size = size;
+    f.fgColor = fgColor;
+    f.bgColor = bgColor;
+    f.strip = strip;
+    return faceCount++;
+}
+
+// Mask of "label " in a face, rasterised on first use
+int8_t DigitAtlas::findLabel(const char* label, uint8_t face) {
+    for (uint8_t i = 0; i < labelCount; i++) {
+        if (labels[i].label == label && labels[i].face == face) return i;
+    }
+    if (labelCount >= ATLAS_MAX_LABELS) return -1;
+
+    uint8_t size = faces[face].size;
+    int16_t w = (strlen(label) + 1) * 6 * size;
+    int16_t h = 8 * size;
+    uint16_t maskW = (w + 7) >> 3;
+
+    uint8_t* mask = (uint8_t*)calloc((uint32_t)maskW * h, 1);
+    if (!mask) return -1;
+
+    TFT_eSprite spr(&tft);
+    spr.setColorDepth(1);
+    if (!spr.createSprite(w, h)) {
+        free(mask);
+        return -1;
+    }
+    spr.fillSprite(TFT_BLACK);
+    spr.setTextColor(TFT_WHITE, TFT_BLACK);
+    spr.setTextSize(size);
+    spr.drawString(label, 0, 0, 1);
+    for (int16_t y = 0; y < h; y++) {
+        for (int16_t x = 0; x < w; x++) {
+            if (spr.readPixelValue(x, y)) mask[y * maskW + (x >> 3)] |= 0x80 >> (x & 7);
+        }
+    }
+    spr.deleteSprite();
+
+    atlas_label& l = labels[labelCount];
+    l.label = label;
+    l.face = face;
+    l.mask = mask;
+    return labelCount++;
+}
@@ -3,6 +3,14 @@
 #include <WiFi.h>
 #include <SPI.h>
 #include <TFT_eSPI.h>
+#include "frame_queue.h"
+#include "can_decoder.h"
+#include "panel_layout.h"
+#include "multi_panel_bus.h"
+#include "band_renderer.h"
+#include "digit_atlas.h"
+#include "arc_gauge.h"
+#include "strip_chart.h"
 
 #define HEIGHT 240
 #define WIDTH  240
@@ -10,170 +18,148 @@
 const int CS_PINS[NUM_DISPLAYS] = { 13, 33, 32, 25, 21 };
 
 TFT_eSPI tft = TFT_eSPI();
+MultiPanelBus bus(tft);
+BandRenderer bands(tft);
+DigitAtlas atlas(tft);
 
-// Structure for received CAN message
-typedef struct struct_message {
-    unsigned long canId;
-    uint8_t len;
-    uint8_t data[8];
-} struct_message;
-
-// Structure for display data
-typedef struct display_data {
-    float vcell[16]; // Vcell1-16
-    float voltT, a;  // From 2214625280
-    float t[4];      // T1-T4
-    float s6;        // Only S6 (labeled as SOC)
-} display_data;
-
-struct_message receivedMessage;
-volatile display_data myData = {0};
-display_data lastData = {0};
-volatile bool newDataAvailable = false;
-
-// Update a single value on a display at a specific position (centered)
-void drawValue(int csPin, const char* label, float value, int x, int y, uint16_t color, bool largeFont = false) {
-    digitalWrite(csPin, LOW);
-    tft.startWrite();
-    tft.setTextColor(color, TFT_BLACK);
-    tft.setTextDatum(MC_DATUM); // Middle-center for all
-    char buffer[20];
-    sprintf(buffer, "%s %.2f", label, value);
-    
-    if (largeFont) {
-        tft.setTextSize(3); // Larger font for SOC, A, VoltT (24x32px)
-    } else {
-        tft.setTextSize(2); // Smaller font for grids (6x8px)
-    }
-    tft.drawString(buffer, x, y);
-    tft.endWrite();
-    digitalWrite(csPin, HIGH);
-}
+// Raw frames from the Wi-Fi task, decoded in loop()
+#define FRAME_QUEUE_SIZE 64
+FrameQueue<struct_message, FRAME_QUEUE_SIZE> frameQueue;
 
-// Update Display 0 (Vcell1-6, custom X, Y coordinates)
-void updateDisplay0() {
-    digitalWrite(CS_PINS[0], LOW);
-    tft.startWrite();
-    tft.fillScreen(TFT_BLACK);
-    // Define your custom X, Y coordinates here
-    drawValue(CS_PINS[0], "VCell1", myData.vcell[0], 120, 20+10, TFT_WHITE);  // Example: top center
-    drawValue(CS_PINS[0], "VCell2", myData.vcell[1], 120, 40+10+15, TFT_WHITE);
-    drawValue(CS_PINS[0], "VCell3", myData.vcell[2], 120, 60+10+30, TFT_WHITE);
-    drawValue(CS_PINS[0], "VCell4", myData.vcell[3], 120, 80+10+45, TFT_WHITE);
-    drawValue(CS_PINS[0], "VCell5", myData.vcell[4], 120, 100+10+60, TFT_WHITE);
-    drawValue(CS_PINS[0], "VCell6", myData.vcell[5], 120, 120+10+75, TFT_WHITE);
-    tft.endWrite();
-    digitalWrite(CS_PINS[0], HIGH);
-}
+display_data myData = {0};
+
+// Panel layouts, custom X, Y coordinates per cell
+// Display 0 (Vcell1-6)
+value_cell cells0[] = {
+    VALUE_CELL("VCell1", myData.vcell[0], 120, 20+10, 2),  // Example: top center
+    VALUE_CELL("VCell2", myData.vcell[1], 120, 40+10+15, 2),
+    VALUE_CELL("VCell3", myData.vcell[2], 120, 60+10+30, 2),
+    VALUE_CELL("VCell4", myData.vcell[3], 120, 80+10+45, 2),
+    VALUE_CELL("VCell5", myData.vcell[4], 120, 100+10+60, 2),
+    VALUE_CELL("VCell6", myData.vcell[5], 120, 120+10+75, 2),
+};
+
+// Display 1 (Vcell7-12)
+value_cell cells1[] = {
+    VALUE_CELL("VCell7", myData.vcell[6], 120, 20+10, 2),  // Example: top center
+    VALUE_CELL("VCell8", myData.vcell[7], 120, 40+10+15, 2),
+    VALUE_CELL("VCell9", myData.vcell[8], 120, 60+10+30, 2),
+    VALUE_CELL("VCell10", myData.vcell[9], 120, 80+10+45, 2),
+    VALUE_CELL("VCell11", myData.vcell[10], 120, 100+10+60, 2),
+    VALUE_CELL("VCell12", myData.vcell[11], 120, 120+10+75, 2),
+};
+
+// Display 2 (Vcell13-16, T1-T4)
+value_cell cells2[] = {
+    VALUE_CELL("VCell13", myData.vcell[12], 120, 20+10, 2),  // Example: top center
+    VALUE_CELL("VCell14", myData.vcell[13], 120, 35+10+10, 2),
+    VALUE_CELL("VCell15", myData.vcell[14], 120, 50+10+20, 2),
+    VALUE_CELL("VCell16", myData.vcell[15], 120, 65+10+30, 2),
+    VALUE_CELL("Temp1", myData.t[0], 120, 80+10+40, 2),
+    VALUE_CELL("Temp2", myData.t[1], 120, 95+10+50, 2),
+    VALUE_CELL("Temp3", myData.t[2], 120, 110+10+60, 2),
+    VALUE_CELL("Temp4", myData.t[3], 120, 125+10+70, 2),
+};
+
+// Display 4 (A, VoltT, vertical split), larger font (18x24px per char)
+value_cell cells4[] = {
+    VALUE_CELL("A", myData.a, WIDTH / 2, HEIGHT / 4, 3),
+    VALUE_CELL("VoltT", myData.voltT, WIDTH / 2, HEIGHT * 3 / 4, 3),
+};
+
+// Display 5 (S6 only, labeled as SOC)
+value_cell cells5[] = {
+    VALUE_CELL("SOC", myData.s6, WIDTH / 2, HEIGHT / 2, 3),
+};
+
+// SOC 0-100 % as a 300 degree ring around the display 5 value, open at the bottom.
+// At most 60 degrees are painted per service() call, a full swing catches up in 5 loops.
+#define SOC_GAUGE_MAX_STEP 60
+ArcGauge socGauge(myData.s6, WIDTH / 2, HEIGHT / 2, 116, 100, 30, 330, 0.0f, 100.0f);
+
+// Cell voltage and pack current history between the display 4 values, one row
+// per second scrolling up (the newest sample is the bottom row)
+#define CHART_SAMPLE_MS   1000
+#define CHART_CELL_MIN    2.8f
+#define CHART_CELL_MAX    4.2f
+#define CHART_CURRENT_MAX 200.0f
+StripChart packChart(20, HEIGHT / 4 + 16, WIDTH - 40, HEIGHT / 2 - 32);
+
+// Panel transfer stats go to Serial at most once per interval, for panels drawn since the last report
+#define PANEL_STATS_MS 1000
 
-// Update Display 1 (Vcell7-12, custom X, Y coordinates)
-void updateDisplay1() {
-    digitalWrite(CS_PINS[1], LOW);
-    tft.startWrite();
-    tft.fillScreen(TFT_BLACK);
-    // Define your custom X, Y coordinates here
-    drawValue(CS_PINS[1], "VCell7", myData.vcell[6], 120, 20+10, TFT_WHITE);  // Example: top center
-    drawValue(CS_PINS[1], "VCell8", myData.vcell[7], 120, 40+10+15, TFT_WHITE);
-    drawValue(CS_PINS[1], "VCell9", myData.vcell[8], 120, 60+10+30, TFT_WHITE);
-    drawValue(CS_PINS[1], "VCell10", myData.vcell[9], 120, 80+10+45, TFT_WHITE);
-    drawValue(CS_PINS[1], "VCell11", myData.vcell[10], 120, 100+10+60, TFT_WHITE);
-    drawValue(CS_PINS[1], "VCell12", myData.vcell[11], 120, 120+10+75, TFT_WHITE);
-    tft.endWrite();
-    digitalWrite(CS_PINS[1], HIGH);
+#define PANEL(cells) { cells, sizeof(cells) / sizeof(cells[0]), TFT_BLACK, TFT_WHITE, false, 0, nullptr, nullptr, false }
+
+panel_layout layout0 = PANEL(cells0);
+panel_layout layout1 = PANEL(cells1);
+panel_layout layout2 = PANEL(cells2);
+panel_layout layout4 = PANEL(cells4);
+panel_layout layout5 = PANEL(cells5);
+
+// Build with -D PANEL_BENCHMARK to compare drawString, glyph atlas and DMA band rendering at boot,
+// and to time the worst SOC gauge update
+#ifdef PANEL_BENCHMARK
+#define BENCHMARK_ROUNDS 20
+
+// Full redraw of every panel, returns the mean time per frame in us
+uint32_t benchmarkFrames(BandRenderer* renderer, DigitAtlas* digitAtlas) {
+    bus.setRenderer(renderer);
+    bus.setAtlas(digitAtlas);
+    bus.resetStats();
+    uint32_t total = 0;
+    for (int n = 0; n < BENCHMARK_ROUNDS; n++) {
+        for (uint8_t i = 0; i < bus.panelCount(); i++) bus.invalidate(i);
+        bus.refresh();
+        bus.service();
+        for (uint8_t i = 0; i < bus.panelCount(); i++) total += bus.stats(i).frameTimeUs;
+    }
+    return total / (BENCHMARK_ROUNDS * bus.panelCount());
 }
 
-// Update Display 2 (Vcell13-16, T1-T4, custom X, Y coordinates)
-void updateDisplay2() {
-    digitalWrite(CS_PINS[2], LOW);
-    tft.startWrite();
-    tft.fillScreen(TFT_BLACK);
-    // Define your custom X, Y coordinates here
-    drawValue(CS_PINS[2], "VCell13", myData.vcell[12], 120, 20+10, TFT_WHITE);  // Example: top center
-    drawValue(CS_PINS[2], "VCell14", myData.vcell[13], 120, 35+10+10, TFT_WHITE);
-    drawValue(CS_PINS[2], "VCell15", myData.vcell[14], 120, 50+10+20, TFT_WHITE);
-    drawValue(CS_PINS[2], "VCell16", myData.vcell[15], 120, 65+10+30, TFT_WHITE);
-    drawValue(CS_PINS[2], "Temp1", myData.t[0], 120, 80+10+40, TFT_WHITE);
-    drawValue(CS_PINS[2], "Temp2", myData.t[1], 120, 95+10+50, TFT_WHITE);
-    drawValue(CS_PINS[2], "Temp3", myData.t[2], 120, 110+10+60, TFT_WHITE);
-    drawValue(CS_PINS[2], "Temp4", myData.t[3], 120, 125+10+70, TFT_WHITE);
-    tft.endWrite();
-    digitalWrite(CS_PINS[2], HIGH);
+void runBenchmark() {
+    uint32_t blocking = benchmarkFrames(nullptr, nullptr);
+    Serial.print("drawString frame us: "); Serial.println(blocking);
+    uint32_t tiles = benchmarkFrames(nullptr, &atlas);
+    Serial.print("Glyph atlas frame us: "); Serial.println(tiles);
+    if (bands.begin(WIDTH, HEIGHT)) {
+        uint32_t pipelined = benchmarkFrames(&bands, nullptr);
+        Serial.print("DMA band frame us: "); Serial.println(pipelined);
+    }
+    bus.setRenderer(nullptr);
+    bus.setAtlas(&atlas);
 }
 
-// Update Display 4 (A, VoltT, vertical split)
-void updateDisplay4() {
-    digitalWrite(CS_PINS[4], LOW);
-    tft.startWrite();
-    tft.fillScreen(TFT_BLACK);
-    drawValue(CS_PINS[4], "A", myData.a, WIDTH / 2, HEIGHT / 4, TFT_WHITE, true);
-    drawValue(CS_PINS[4], "VoltT", myData.voltT, WIDTH / 2, HEIGHT *3 / 4, TFT_WHITE, true);
-    tft.endWrite();
-    digitalWrite(CS_PINS[4], HIGH);
+// Worst service() call drawing the SOC panel (gauge segment and label) in us, with the
+// value swinging by swing % around 50 % every refresh
+uint32_t benchmarkGauge(uint8_t panel, uint16_t maxStep, float swing) {
+    float soc = myData.s6;
+    socGauge.setMaxStep(maxStep);
+    bus.resetStats();
+    for (int n = 0; n < BENCHMARK_ROUNDS; n++) {
+        myData.s6 = (n & 1) ? 50.0f - swing / 2 : 50.0f + swing / 2;
+        bus.refresh();
+        while (bus.isDirty(panel)) bus.service();
+    }
+    myData.s6 = soc;
+    socGauge.setMaxStep(SOC_GAUGE_MAX_STEP);
+    return bus.maxServiceUs();
 }
 
-// Update Display 5 (S6 only, labeled as SOC)
-void updateDisplay5() {
-    digitalWrite(CS_PINS[3], LOW);
-    tft.startWrite();
-    tft.fillScreen(TFT_BLACK);
-    drawValue(CS_PINS[3], "SOC", myData.s6, WIDTH / 2, HEIGHT / 2, TFT_WHITE, true);
-    tft.endWrite();
-    digitalWrite(CS_PINS[3], HIGH);
+void runGaugeBenchmark(uint8_t panel) {
+    Serial.print("SOC gauge full swing worst us: "); Serial.println(benchmarkGauge(panel, 0, 100.0f));
+    Serial.print("SOC gauge full swing worst us, step limited: ");
+    Serial.println(benchmarkGauge(panel, SOC_GAUGE_MAX_STEP, 100.0f));
+    Serial.print("SOC gauge 1 % step worst us: "); Serial.println(benchmarkGauge(panel, 0, 1.0f));
 }
+#endif
 
+// Runs in the Wi-Fi task: only enqueue the raw frame, decoding happens in loop()
 void OnDataRecv(const uint8_t *mac, const uint8_t *incomingData, int len) {
-    memcpy(&receivedMessage, incomingData, sizeof(receivedMessage));
-    
-    Serial.print("CAN ID: "); Serial.print(receivedMessage.canId);
-    Serial.print(" | Len: "); Serial.println(receivedMessage.len);
-
-    if (receivedMessage.canId == 2281734144) {
-        for (int i = 0; i < receivedMessage.len; i += 2) {
-            uint16_t word = (receivedMessage.data[i] << 8) | (i + 1 < receivedMessage.len ? receivedMessage.data[i + 1] : 0);
-            myData.vcell[i / 2] = (float)word / 1000.0;
-        }
-    }
-    else if (receivedMessage.canId == 2281799680) {
-        for (int i = 0; i < receivedMessage.len; i += 2) {
-            uint16_t word = (receivedMessage.data[i] << 8) | (i + 1 < receivedMessage.len ? receivedMessage.data[i + 1] : 0);
-            myData.vcell[i / 2 + 4] = (float)word / 1000.0;
-        }
-    }
-    else if (receivedMessage.canId == 2281865216) {
-        for (int i = 0; i < receivedMessage.len; i += 2) {
-            uint16_t word = (receivedMessage.data[i] << 8) | (i + 1 < receivedMessage.len ? receivedMessage.data[i + 1] : 0);
-            myData.vcell[i / 2 + 8] = (float)word / 1000.0;
-        }
-    }
-    else if (receivedMessage.canId == 2281930752) {
-        for (int i = 0; i < receivedMessage.len; i += 2) {
-            uint16_t word = (receivedMessage.data[i] << 8) | (i + 1 < receivedMessage.len ? receivedMessage.data[i + 1] : 0);
-            myData.vcell[i / 2 + 12] = (float)word / 1000.0;
-        }
-    }
-    else if (receivedMessage.canId == 2214625280) {
-        for (int i = 0; i < receivedMessage.len; i += 2) {
-            uint16_t word = (receivedMessage.data[i] << 8) | (i + 1 < receivedMessage.len ? receivedMessage.data[i + 1] : 0);
-            if (i == 0) myData.voltT = (float)word / 10.0;
-            else if (i == 2) myData.a = ((float)word - 30000.0) / 10.0;
-        }
-    }
-    else if (receivedMessage.canId == 2415951872) {
-        for (int i = 0; i < min((int)4, (int)receivedMessage.len); i++) {
-            myData.t[i] = (float)(receivedMessage.data[i] - 40);
-        }
-    }
-    else if (receivedMessage.canId == 2214756352) {
-        for (int i = 0; i < receivedMessage.len; i++) {
-            if (i == 5 && i + 1 < receivedMessage.len) {
-                uint16_t byte56 = (receivedMessage.data[i] << 8) | receivedMessage.data[i + 1];
-                myData.s6 = (float)byte56 / 160.0;
-                Serial.print("S6 updated to: "); Serial.println(myData.s6);
-                break;
-            }
-        }
-    }
-    newDataAvailable = true;
+    struct_message frame;
+    if (len < (int)sizeof(frame)) return;
+    memcpy(&frame, incomingData, sizeof(frame));
+    if (frame.len > sizeof(frame.data)) frame.len = sizeof(frame.data);
+    frameQueue.push(frame);
 }
 
 void setup() {
@@ -182,15 +168,37 @@ void setup() {
 
     tft.begin();
     tft.setRotation(0);
-    for (int i = 0; i < NUM_DISPLAYS; i++) {
-        pinMode(CS_PINS[i], OUTPUT);
-        digitalWrite(CS_PINS[i], HIGH);
-        digitalWrite(CS_PINS[i], LOW);
-        tft.startWrite();
-        tft.fillScreen(TFT_BLACK);
-        tft.endWrite();
-        digitalWrite(CS_PINS[i], HIGH);
-    }
+    bus.addPanel(CS_PINS[0], &layout0);
+    bus.addPanel(CS_PINS[1], &layout1);
+    bus.addPanel(CS_PINS[2], &layout2);
+    for (uint8_t i = 0; i < 16; i++) packChart.addTrace(myData.vcell[i], CHART_CELL_MIN, CHART_CELL_MAX, TFT_CYAN);
+    packChart.addTrace(myData.a, -CHART_CURRENT_MAX, CHART_CURRENT_MAX, TFT_YELLOW);
+    packChart.setBackground(layout4.bgColor);
+    layout4.chart = &packChart;
+    bus.addPanel(CS_PINS[4], &layout4);
+    socGauge.setColors(TFT_GREEN, TFT_DARKGREY, layout5.bgColor);
+    socGauge.setMaxStep(SOC_GAUGE_MAX_STEP);
+    layout5.gauge = &socGauge;
+    int8_t socPanel = bus.addPanel(CS_PINS[3], &layout5);
+    bus.begin();
+    // Values are blitted from pre-rendered glyph tiles, one address window per
+    // changed cell. This sends far fewer bytes than re-sending whole DMA bands.
+    bus.setAtlas(&atlas);
+#ifdef PANEL_BENCHMARK
+    runBenchmark();
+    runGaugeBenchmark(socPanel);
+#else
+    (void)socPanel;
+#endif
+#ifdef PANEL_RENDER_BANDS
+    // Build with -D PANEL_RENDER_BANDS to draw through the DMA band pipeline instead,
+    // the glyph atlas stays in use if the band sprites or DMA cannot be set up
+    if (bands.begin(WIDTH, HEIGHT)) bus.setRenderer(&bands);
+    else Serial.println("Band sprites or DMA not available, using glyph atlas");
+#endif
+    // First pass clears each screen and draws every cell
+    bus.refresh();
+    bus.service();
 
     WiFi.mode(WIFI_STA);
     if (esp_now_init() != ESP_OK) {
@@ -205,36 +213,47 @@ void setup() {
 }
 
 void loop() {
-    if (newDataAvailable) {
-        noInterrupts();
-        display_data localData;
-        memcpy(&localData, (void*)&myData, sizeof(display_data));
-        newDataAvailable = false;
-        interrupts();
-
-        if (memcmp(&localData.vcell[0], &lastData.vcell[0], 6 * sizeof(float)) != 0) {
-            updateDisplay0();
-            memcpy(&lastData.vcell[0], &localData.vcell[0], 6 * sizeof(float));
-        }
-        if (memcmp(&localData.vcell[6], &lastData.vcell[6], 6 * sizeof(float)) != 0) {
-            updateDisplay1();
-            memcpy(&lastData.vcell[6], &localData.vcell[6], 6 * sizeof(float));
-        }
-        if (memcmp(&localData.vcell[12], &lastData.vcell[12], 4 * sizeof(float)) != 0 || 
-            memcmp(&localData.t, &lastData.t, 4 * sizeof(float)) != 0) {
-            updateDisplay2();
-            memcpy(&lastData.vcell[12], &localData.vcell[12], 4 * sizeof(float));
-            memcpy(&lastData.t, &lastData.t, 4 * sizeof(float));
-        }
-        if (localData.a != lastData.a || localData.voltT != lastData.voltT) {
-            updateDisplay4();
-            lastData.a = localData.a;
-            lastData.voltT = localData.voltT;
-        }
-        if (localData.s6 != lastData.s6) {
-            updateDisplay5();
-            lastData.s6 = localData.s6;
-            Serial.println("Updating Display 5 with S6");
+    struct_message frame;
+    bool newDataAvailable = false;
+    while (frameQueue.pop(frame)) {
+        Serial.print("CAN ID: "); Serial.print(frame.canId);
+        Serial.print(" | Len: "); Serial.println(frame.len);
+        if (decodeCanFrame(frame, myData)) newDataAvailable = true;
+    }
+
+    // The queue counters belong to the producer, report the change since the last report
+    static uint32_t lastDropped = 0;
+    uint32_t dropped = frameQueue.droppedCount();
+    if (dropped != lastDropped) {
+        Serial.print("Frames dropped: "); Serial.print(dropped - lastDropped);
+        Serial.print(" | Queue high water: "); Serial.println(frameQueue.highWaterMark());
+        lastDropped = dropped;
+    }
+
+    static uint32_t lastSample = millis();
+    if (millis() - lastSample >= CHART_SAMPLE_MS) {
+        lastSample += CHART_SAMPLE_MS;
+        packChart.sample();
+        newDataAvailable = true;
+    }
+
+    // Only cells whose formatted string changed, and new chart rows, are repainted
+    if (newDataAvailable) bus.refresh();
+    bus.service();
+
+    static uint32_t lastStats = millis();
+    static uint32_t lastFrames[MAX_PANELS] = {0};
+    if (millis() - lastStats >= PANEL_STATS_MS) {
+        lastStats = millis();
+        for (uint8_t i = 0; i < bus.panelCount(); i++) {
+            const panel_stats& stats = bus.stats(i);
+            if (stats.frames == lastFrames[i]) continue;
+            Serial.print("Panel "); Serial.print(i);
+            Serial.print(" | frames: "); Serial.print(stats.frames - lastFrames[i]);
+            Serial.print(" | us: "); Serial.print(stats.frameTimeUs);
+            Serial.print(" | max us: "); Serial.print(stats.maxFrameTimeUs);
+            Serial.print(" | bytes: "); Serial.println(stats.bytesOnWire);
+            lastFrames[i] = stats.frames;
         }
     }
     delay(100);
@@ -0,0 +1,117 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "multi_panel_bus.h"
+#include "band_renderer.h"
+
+static_assert(MAX_PANELS <= 16, "service() keeps the due panels in a 16-bit mask");
+
+MultiPanelBus::MultiPanelBus(TFT_eSPI& tft) : tft(tft), bandRenderer(nullptr), atlas(nullptr), count(0),
+    serviceTimeUs(0), maxServiceTimeUs(0) {
+    memset(panels, 0, sizeof(panels));
+}
+
+int8_t MultiPanelBus::addPanel(int csPin, panel_layout* layout) {
+    if (count >= MAX_PANELS) return -1;
+    panel_slot& slot = panels[count];
+    slot.csPin = csPin;
+    slot.layout = layout;
+    slot.dirty = true;
+    slot.lastServiced = 0;
+    memset(&slot.stats, 0, sizeof(slot.stats));
+    return count++;
+}
+
+void MultiPanelBus::begin() {
+    for (uint8_t i = 0; i < count; i++) {
+        pinMode(panels[i].csPin, OUTPUT);
+        digitalWrite(panels[i].csPin, HIGH);
+        invalidate(i);
+    }
+}
+
+uint8_t MultiPanelBus::refresh() {
+    uint8_t dirty = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (refreshPanel(*panels[i].layout)) panels[i].dirty = true;
+        if (panels[i].dirty) dirty++;
+    }
+    return dirty;
+}
+
+uint8_t MultiPanelBus::service(uint8_t maxPanels) {
+    // Only panels dirty on entry are drawn, each at most once, so a panel that is still
+    // pending afterwards (e.g. a step limited gauge) waits for the next call
+    uint16_t due = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (panels[i].dirty) due |= 1 << i;
+    }
+
+    uint8_t drawn = 0;
+    uint32_t callStart = micros();
+    while (drawn < maxPanels) {
+        uint32_t now = millis();
+        int8_t panel = stalestDirty(now, due);
+        if (panel < 0) break;
+        due &= ~(1 << panel);
+
+        panel_slot& slot = panels[panel];
+        uint32_t start = micros();
+        select(panel);
+        uint32_t pixels = bandRenderer ? bandRenderer->drawPanel(*slot.layout) : drawPanel(tft, *slot.layout, atlas);
+        deselect(panel);
+        uint32_t elapsed = micros() - start;
+
+        slot.dirty = slot.layout->pending;
+        slot.lastServiced = now;
+        slot.stats.frameTimeUs = elapsed;
+        if (elapsed > slot.stats.maxFrameTimeUs) slot.stats.maxFrameTimeUs = elapsed;
+        slot.stats.bytesOnWire = pixels * 2;
+        slot.stats.totalBytes += pixels * 2;
+        slot.stats.frames++;
+        drawn++;
+    }
+
+    if (drawn) {
+        serviceTimeUs = micros() - callStart;
+        if (serviceTimeUs > maxServiceTimeUs) maxServiceTimeUs = serviceTimeUs;
+    }
+    return drawn;
+}
+
+void MultiPanelBus::invalidate(uint8_t panel) {
+    if (panel >= count) return;
+    invalidatePanel(*panels[panel].layout);
+    panels[panel].dirty = true;
+}
+
+void MultiPanelBus::resetStats() {
+    for (uint8_t i = 0; i < count; i++) memset(&panels[i].stats, 0, sizeof(panel_stats));
+    serviceTimeUs = maxServiceTimeUs = 0;
+}
+
+// The panel CS is held low for the whole transaction, the library only
+// drives its own TFT_CS which is not one of the panel CS pins
+void MultiPanelBus::select(uint8_t panel) {
+    digitalWrite(panels[panel].csPin, LOW);
+    tft.startWrite();
+}
+
+void MultiPanelBus::deselect(uint8_t panel) {
+    tft.endWrite();
+    digitalWrite(panels[panel].csPin, HIGH);
+}
+
+// Round-robin by staleness: the due panel that has waited longest goes first
+int8_t MultiPanelBus::stalestDirty(uint32_t now, uint16_t due) const {
+    int8_t best = -1;
+    uint32_t bestAge = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (!(due & (1 << i))) continue;
+        uint32_t age = now - panels[i].lastServiced;
+        if (best < 0 || age > bestAge) {
+            best = i;
+            bestAge = age;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,77 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "panel_layout.h"
+#include "digit_atlas.h"
+#include "arc_gauge.h"
+#include "strip_chart.h"
+
+bool refreshPanel(panel_layout& panel) {
+    char buffer[CELL_TEXT_LEN];
+    bool pending = !panel.cleared;
+
+    for (uint8_t i = 0; i < panel.count; i++) {
+        value_cell& cell = panel.cells[i];
+        snprintf(buffer, sizeof(buffer), "%s %.2f", cell.label, *cell.value);
+        if (strcmp(buffer, cell.text) != 0) {
+            strcpy(cell.text, buffer);
+            cell.changed = true;
+        }
+        pending |= cell.changed;
+    }
+    if (panel.gauge && panel.gauge->pending()) pending = true;
+    if (panel.chart && panel.chart->pending()) pending = true;
+    return pending;
+}
+
+uint32_t drawPanel(TFT_eSPI& tft, panel_layout& panel, DigitAtlas* atlas) {
+    uint32_t pixels = 0;
+
+    if (!panel.cleared) {
+        tft.fillScreen(panel.bgColor);
+        pixels += (uint32_t)tft.width() * tft.height();
+        panel.cleared = true;
+    }
+
+    tft.setTextColor(panel.fgColor, panel.bgColor);
+    tft.setTextDatum(MC_DATUM);
+
+    for (uint8_t i = 0; i < panel.count; i++) {
+        value_cell& cell = panel.cells[i];
+        if (!cell.changed) continue;
+
+        // Pad to the wider of the old and new strings so stale pixels are erased
+        tft.setTextSize(cell.size);
+        int16_t width = tft.textWidth(cell.text);
+        int16_t pad = width > cell.width ? width : cell.width;
+        uint32_t drawn = atlas ? atlas->drawCell(cell, panel.fgColor, panel.bgColor, pad) : 0;
+        if (!drawn) {
+            tft.setTextPadding(pad);
+            tft.drawString(cell.text, cell.x, cell.y);
+            drawn = (uint32_t)pad * tft.fontHeight();
+        }
+        pixels += drawn;
+
+        cell.width = width;
+        cell.changed = false;
+    }
+    tft.setTextPadding(0);
+
+    if (panel.gauge) {
+        pixels += panel.gauge->draw(tft);
+        panel.pending = panel.gauge->pending();
+    }
+    if (panel.chart) pixels += panel.chart->draw(tft);
+
+    panel.pixelsPushed = pixels;
+    return pixels;
+}
+
+void invalidatePanel(panel_layout& panel) {
+    panel.cleared = false;
+    if (panel.gauge) panel.gauge->invalidate();
+    if (panel.chart) panel.chart->invalidate();
+    for (uint8_t i = 0; i < panel.count; i++) {
+        panel.cells[i].width = 0;
+        panel.cells[i].changed = true;
+    }
+}
@@ -0,0 +1,146 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "strip_chart.h"
+
+#define CHART_NO_VALUE 0xFF
+
+StripChart::StripChart(int16_t x, int16_t y, int16_t width, int16_t rows)
+    : traceCount(0), x(x), y(y), width(width), rows(rows), bgColor(TFT_BLACK),
+      head(0), filled(0), undrawn(0), shownHead(-1), drawn(false), scrollSet(false), hwScroll(true) {
+    if (this->width > CHART_MAX_WIDTH) this->width = CHART_MAX_WIDTH;
+    if (this->rows > CHART_MAX_ROWS) this->rows = CHART_MAX_ROWS;
+    if (this->rows < 1) this->rows = 1;
+    head = this->rows - 1; // The first sample goes in slot 0
+}
+
+bool StripChart::addTrace(const float& value, float minValue, float maxValue, uint16_t color) {
+    if (traceCount >= CHART_MAX_TRACES || !(maxValue > minValue)) return false;
+    chart_trace& trace = traces[traceCount++];
+    trace.value = &value;
+    trace.minValue = minValue;
+    trace.scale = (width - 1) / (maxValue - minValue);
+    trace.color = color;
+    drawn = false;
+    return true;
+}
+
+void StripChart::sample() {
+    head = head + 1 < rows ? head + 1 : 0;
+    for (uint8_t t = 0; t < traceCount; t++) {
+        const chart_trace& trace = traces[t];
+        float v = *trace.value;
+        uint8_t px = CHART_NO_VALUE;
+        if (v == v) { // Not NaN
+            float f = (v - trace.minValue) * trace.scale + 0.5f;
+            px = f <= 0 ? 0 : f >= width - 1 ? width - 1 : (uint8_t)f;
+        }
+        xs[head][t] = px;
+    }
+    if (filled < rows) filled++;
+    if (undrawn < rows) undrawn++;
+}
+
+bool StripChart::pending() const {
+    return !drawn || undrawn || !scrollSet || (hwScroll && shownHead != head);
+}
+
+uint32_t StripChart::draw(TFT_eSPI& tft) {
+    if (!scrollSet) {
+        hwScroll = tft.setScrollArea(y, rows);
+        scrollSet = true;
+        shownHead = -1;
+        if (!hwScroll) drawn = false; // Bands may have composed it in ring order
+    }
+
+    uint32_t pixels = 0;
+    bool swap = tft.getSwapBytes();
+    tft.setSwapBytes(false);
+    if (!drawn || (undrawn && !hwScroll)) {
+        for (int16_t r = 0; r < rows; r++) drawRow(tft, slotAt(r), y + r);
+        pixels = (uint32_t)rows * width;
+    }
+    else {
+        // Only the new rows, each in its own slot's display RAM row
+        for (int16_t i = undrawn - 1; i >= 0; i--) {
+            int16_t slot = head >= i ? head - i : head - i + rows;
+            drawRow(tft, slot, y + slot);
+            pixels += width;
+        }
+    }
+    tft.setSwapBytes(swap);
+    drawn = true;
+    undrawn = 0;
+
+    // Oldest slot at the top of the scroll area, newest at the bottom
+    if (hwScroll && shownHead != head) {
+        tft.scrollTo(y + (head + 1 < rows ? head + 1 : 0));
+        shownHead = head;
+    }
+    return pixels;
+}
+
+void StripChart::compose(TFT_eSPI& band, int16_t y0) const {
+    int16_t r0 = y > y0 ? y : y0;
+    int16_t r1 = y + rows < y0 + band.height() ? y + rows : y0 + band.height();
+    for (int16_t r = r0; r < r1; r++) {
+        band.drawFastHLine(x, r - y0, width, bgColor);
+        int16_t slot = slotAt(r - y);
+        for (uint8_t t = 0; t < traceCount; t++) {
+            int16_t xs, len;
+            if (traceSpan(slot, t, &xs, &len)) band.drawFastHLine(x + xs, r - y0, len, traces[t].color);
+        }
+    }
+}
+
+void StripChart::markDrawn() {
+    drawn = true;
+    undrawn = 0;
+}
+
+void StripChart::invalidate() {
+    drawn = false;
+    scrollSet = false;
+    undrawn = 0;
+    shownHead = -1;
+}
+
+// Slot shown on chart row r: rows map to fixed slots when the display scrolls,
+// otherwise the rows are painted oldest first
+int16_t StripChart::slotAt(int16_t r) const {
+    if (hwScroll) return r;
+    int16_t slot = head + 1 + r;
+    return slot < rows ? slot : slot - rows;
+}
+
+// Pixels of a trace in a slot, from its previous sample's x to this one's
+bool StripChart::traceSpan(int16_t slot, uint8_t trace, int16_t* xs, int16_t* len) const {
+    if (slot >= filled) return false;
+    uint8_t cur = this->xs[slot][trace];
+    if (cur == CHART_NO_VALUE) return false;
+
+    int16_t from = cur, to = cur;
+    int16_t oldest = filled < rows ? 0 : (head + 1 < rows ? head + 1 : 0);
+    if (slot != oldest) {
+        uint8_t prev = this->xs[slot ? slot - 1 : rows - 1][trace];
+        if (prev != CHART_NO_VALUE) {
+            if (prev < from) from = prev;
+            else to = prev;
+        }
+    }
+    *xs = from;
+    *len = to - from + 1;
+    return true;
+}
+
+void StripChart::drawRow(TFT_eSPI& tft, int16_t slot, int16_t r) {
+    uint16_t bg = bgColor << 8 | bgColor >> 8; // Panel byte order
+    for (int16_t i = 0; i < width; i++) row[i] = bg;
+    for (uint8_t t = 0; t < traceCount; t++) {
+        int16_t xs, len;
+        if (!traceSpan(slot, t, &xs, &len)) continue;
+        uint16_t color = traces[t].color << 8 | traces[t].color >> 8;
+        for (int16_t i = 0; i < len; i++) row[xs + i] = color;
+    }
+    tft.setAddrWindow(x, r, width, 1);
+    tft.pushPixels(row, width);
+}
@@ -0,0 +1,164 @@
+// CAN decoder tests, run on the host with: pio test -e native
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "can_decoder.h"
+
+// Fields a frame decodes into, as indices into display_data viewed as a float array
+#define F(member) (uint8_t)(offsetof(display_data, member) / sizeof(float))
+#define NUM_FIELDS (sizeof(display_data) / sizeof(float))
+#define UNSET -999.0f
+
+typedef struct {
+    uint32_t canId;
+    uint8_t  data[8];
+    uint8_t  fields;
+    uint8_t  field[4];
+    uint8_t  end[4];   // Frame length needed to hold each field's signal
+    float    value[4];
+} frame_case;
+
+// Reference frames for every CAN ID, one per ID, laid out by the pack's signal
+// definitions with values in the normal operating range
+static const frame_case frames[] = {
+    // Pack 54.0 V, +10.0 A (raw 30100 with -3000 A offset)
+    { 0x84008000, { 0x02, 0x1C, 0x75, 0x94, 0x00, 0x00, 0x00, 0x00 },
+      2, { F(voltT), F(a) }, { 2, 4 }, { 54.0f, 10.0f } },
+    // SOC 93.75 % (raw 15000 / 160) in bytes 5-6
+    { 0x84028000, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x98, 0x00 },
+      1, { F(s6) }, { 7 }, { 93.75f } },
+    // Cells 1-4: 3300, 3301, 3320, 3330 mV
+    { 0x88008000, { 0x0C, 0xE4, 0x0C, 0xE5, 0x0C, 0xF8, 0x0D, 0x02 },
+      4, { F(vcell[0]), F(vcell[1]), F(vcell[2]), F(vcell[3]) }, { 2, 4, 6, 8 }, { 3.300f, 3.301f, 3.320f, 3.330f } },
+    // Cells 5-8: 3290, 3310, 3305, 3298 mV
+    { 0x88018000, { 0x0C, 0xDA, 0x0C, 0xEE, 0x0C, 0xE9, 0x0C, 0xE2 },
+      4, { F(vcell[4]), F(vcell[5]), F(vcell[6]), F(vcell[7]) }, { 2, 4, 6, 8 }, { 3.290f, 3.310f, 3.305f, 3.298f } },
+    // Cells 9-12: 2800, 3650, 3312, 3313 mV
+    { 0x88028000, { 0x0A, 0xF0, 0x0E, 0x42, 0x0C, 0xF0, 0x0C, 0xF1 },
+      4, { F(vcell[8]), F(vcell[9]), F(vcell[10]), F(vcell[11]) }, { 2, 4, 6, 8 }, { 2.800f, 3.650f, 3.312f, 3.313f } },
+    // Cells 13-16: 3302, 3303, 3304, 65535 mV (full scale)
+    { 0x88038000, { 0x0C, 0xE6, 0x0C, 0xE7, 0x0C, 0xE8, 0xFF, 0xFF },
+      4, { F(vcell[12]), F(vcell[13]), F(vcell[14]), F(vcell[15]) }, { 2, 4, 6, 8 }, { 3.302f, 3.303f, 3.304f, 65.535f } },
+    // Temperatures 25, 20, 0, -10 C
+    { 0x90008000, { 0x41, 0x3C, 0x28, 0x1E, 0x00, 0x00, 0x00, 0x00 },
+      4, { F(t[0]), F(t[1]), F(t[2]), F(t[3]) }, { 1, 2, 3, 4 }, { 25.0f, 20.0f, 0.0f, -10.0f } },
+};
+
+#define NUM_FRAMES (sizeof(frames) / sizeof(frames[0]))
+
+static struct_message message(const frame_case& c, uint8_t len) {
+    struct_message m;
+    memset(&m, 0, sizeof(m));
+    m.canId = c.canId;
+    m.len = len;
+    memcpy(m.data, c.data, 8);
+    return m;
+}
+
+static void fillUnset(display_data& d) {
+    float* f = (float*)&d;
+    for (size_t i = 0; i < NUM_FIELDS; i++) f[i] = UNSET;
+}
+
+// Returns the expected value of field i after decoding case c with the given length
+static float expected(const frame_case& c, uint8_t len, size_t i) {
+    for (uint8_t s = 0; s < c.fields; s++) {
+        if (c.field[s] != i) continue;
+        return (c.end[s] > len) ? UNSET : c.value[s];
+    }
+    return UNSET;
+}
+
+static void checkDecode(const frame_case& c, uint8_t len) {
+    display_data d;
+    fillUnset(d);
+    struct_message m = message(c, len);
+    TEST_ASSERT_TRUE(decodeCanFrame(m, d));
+
+    const float* f = (const float*)&d;
+    for (size_t i = 0; i < NUM_FIELDS; i++) {
+        float e = expected(c, len, i);
+        if (e == UNSET) TEST_ASSERT_EQUAL_FLOAT(UNSET, f[i]);
+        else TEST_ASSERT_FLOAT_WITHIN(0.0005f, e, f[i]);
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+// Every message in the table has a reference frame
+void test_every_id_covered() {
+    size_t count;
+    const can_message* msg = canMessageTable(&count);
+    TEST_ASSERT_EQUAL_UINT32(NUM_FRAMES, count);
+    for (size_t i = 0; i < count; i++) {
+        bool found = false;
+        for (size_t j = 0; j < NUM_FRAMES; j++) {
+            if (frames[j].canId == msg[i].canId) {
+                found = true;
+                TEST_ASSERT_EQUAL_UINT32(msg[i].count, frames[j].fields);
+            }
+        }
+        TEST_ASSERT_TRUE(found);
+        TEST_ASSERT_EQUAL_PTR(&msg[i], findCanMessage(msg[i].canId));
+    }
+}
+
+// Full length frames set exactly the fields of their ID and nothing else
+void test_full_frames() {
+    for (size_t j = 0; j < NUM_FRAMES; j++) checkDecode(frames[j], 8);
+}
+
+// A short frame decodes only the signals it holds completely, the others keep their value
+void test_short_frames() {
+    for (size_t j = 0; j < NUM_FRAMES; j++) {
+        for (uint8_t len = 0; len < 8; len++) checkDecode(frames[j], len);
+    }
+}
+
+// Lengths over 8 are treated as 8
+void test_long_len_clamped() {
+    for (size_t j = 0; j < NUM_FRAMES; j++) checkDecode(frames[j], 15);
+}
+
+// Frames decode independently, e.g. a cell frame does not touch the temperatures
+void test_frames_accumulate() {
+    display_data d;
+    fillUnset(d);
+    for (size_t j = 0; j < NUM_FRAMES; j++) {
+        struct_message m = message(frames[j], 8);
+        TEST_ASSERT_TRUE(decodeCanFrame(m, d));
+    }
+    const float* f = (const float*)&d;
+    for (size_t j = 0; j < NUM_FRAMES; j++) {
+        for (uint8_t s = 0; s < frames[j].fields; s++) {
+            TEST_ASSERT_FLOAT_WITHIN(0.0005f, frames[j].value[s], f[frames[j].field[s]]);
+        }
+    }
+}
+
+void test_unknown_id() {
+    static const uint32_t ids[] = { 0, 0x84008001, 0x84018000, 0x88048000, 0x8FFFFFFF, 0x90008001, 0xFFFFFFFF };
+    display_data d, before;
+    fillUnset(d);
+    struct_message m = message(frames[2], 8);
+    for (size_t i = 0; i < sizeof(ids) / sizeof(ids[0]); i++) {
+        m.canId = ids[i];
+        TEST_ASSERT_NULL(findCanMessage(ids[i]));
+        memcpy(&before, &d, sizeof(d));
+        TEST_ASSERT_FALSE(decodeCanFrame(m, d));
+        TEST_ASSERT_EQUAL_MEMORY(&before, &d, sizeof(d));
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_every_id_covered);
+    RUN_TEST(test_full_frames);
+    RUN_TEST(test_short_frames);
+    RUN_TEST(test_long_len_clamped);
+    RUN_TEST(test_frames_accumulate);
+    RUN_TEST(test_unknown_id);
+    return UNITY_END();
+}
@@ -0,0 +1,159 @@
+// FrameQueue single-producer / single-consumer tests, run on the host with: pio test -e native
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+
+#include "frame_queue.h"
+#include "can_decoder.h"
+
+// Frames per stress run, canId carries the sequence number. Both sides yield when they
+// cannot make progress so the test also completes on a single core host
+static const uint32_t STRESS_FRAMES = 1000000;
+static const size_t   QUEUE_SIZE    = 16;
+
+typedef FrameQueue<struct_message, QUEUE_SIZE> TestQueue;
+
+static struct_message frame(uint32_t seq) {
+    struct_message m;
+    memset(&m, 0, sizeof(m));
+    m.canId = seq;
+    m.len = 8;
+    memcpy(m.data, &seq, sizeof(seq));
+    memcpy(m.data + 4, &seq, sizeof(seq));
+    return m;
+}
+
+// Frame contents must match the sequence number in canId, i.e. not torn by a concurrent push
+static bool intact(const struct_message& m) {
+    uint32_t a, b;
+    memcpy(&a, m.data, sizeof(a));
+    memcpy(&b, m.data + 4, sizeof(b));
+    return m.len == 8 && a == (uint32_t)m.canId && b == (uint32_t)m.canId;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_fill_and_overflow() {
+    TestQueue q;
+    struct_message m;
+
+    TEST_ASSERT_TRUE(q.empty());
+    TEST_ASSERT_FALSE(q.pop(m));
+
+    for (uint32_t i = 0; i < QUEUE_SIZE; i++) TEST_ASSERT_TRUE(q.push(frame(i)));
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_SIZE, q.size());
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_SIZE, q.highWaterMark());
+    TEST_ASSERT_EQUAL_UINT32(0, q.droppedCount());
+
+    // Full: the new frame is dropped and the queued ones are kept
+    TEST_ASSERT_FALSE(q.push(frame(100)));
+    TEST_ASSERT_FALSE(q.push(frame(101)));
+    TEST_ASSERT_EQUAL_UINT32(2, q.droppedCount());
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_SIZE, q.size());
+
+    for (uint32_t i = 0; i < QUEUE_SIZE; i++) {
+        TEST_ASSERT_TRUE(q.pop(m));
+        TEST_ASSERT_EQUAL_UINT32(i, m.canId);
+    }
+    TEST_ASSERT_FALSE(q.pop(m));
+
+    // Counters are monotonic, draining does not lower them
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_SIZE, q.highWaterMark());
+    TEST_ASSERT_EQUAL_UINT32(2, q.droppedCount());
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_SIZE, q.pushedCount());
+}
+
+void test_high_water_tracks_peak() {
+    TestQueue q;
+    struct_message m;
+
+    for (uint32_t i = 0; i < 5; i++) q.push(frame(i));
+    while (q.pop(m)) {}
+    for (uint32_t i = 0; i < 3; i++) q.push(frame(i));
+    TEST_ASSERT_EQUAL_UINT32(5, q.highWaterMark());
+
+    while (q.pop(m)) {}
+    for (uint32_t i = 0; i < 9; i++) q.push(frame(i));
+    TEST_ASSERT_EQUAL_UINT32(9, q.highWaterMark());
+    TEST_ASSERT_EQUAL_UINT32(0, q.droppedCount());
+}
+
+// The producer pushes each frame once and counts its own failures. Every frame that is
+// delivered must be intact and in order, and the queue drop count must match the producer's.
+void test_stress_lossy() {
+    static TestQueue q;
+    std::atomic<bool> done(false);
+    uint32_t producerDrops = 0;
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < STRESS_FRAMES; i++) {
+            if (!q.push(frame(i))) { producerDrops++; std::this_thread::yield(); }
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    uint32_t received = 0, torn = 0, outOfOrder = 0;
+    int64_t last = -1;
+    struct_message m;
+    for (;;) {
+        if (q.pop(m)) {
+            if (!intact(m)) torn++;
+            if ((int64_t)m.canId <= last) outOfOrder++;
+            last = m.canId;
+            received++;
+        }
+        else if (done.load(std::memory_order_acquire) && q.empty()) break;
+        else std::this_thread::yield();
+    }
+    producer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, torn);
+    TEST_ASSERT_EQUAL_UINT32(0, outOfOrder);
+    TEST_ASSERT_EQUAL_UINT32(STRESS_FRAMES, received + producerDrops);
+    TEST_ASSERT_EQUAL_UINT32(producerDrops, q.droppedCount());
+    TEST_ASSERT_EQUAL_UINT32(received, q.pushedCount());
+    TEST_ASSERT_TRUE(q.highWaterMark() >= 1);
+    TEST_ASSERT_TRUE(q.highWaterMark() <= QUEUE_SIZE);
+    if (producerDrops) TEST_ASSERT_EQUAL_UINT32(QUEUE_SIZE, q.highWaterMark());
+}
+
+// The producer retries until each push succeeds, so the consumer must see every sequence
+// number exactly once and in order. Each failed attempt is still counted as a drop.
+void test_stress_lossless() {
+    static TestQueue q;
+    uint32_t producerDrops = 0;
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < STRESS_FRAMES; i++) {
+            while (!q.push(frame(i))) { producerDrops++; std::this_thread::yield(); }
+        }
+    });
+
+    uint32_t expected = 0, errors = 0;
+    struct_message m;
+    while (expected < STRESS_FRAMES) {
+        if (!q.pop(m)) { std::this_thread::yield(); continue; }
+        if (m.canId != expected || !intact(m)) errors++;
+        expected++;
+    }
+    producer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, errors);
+    TEST_ASSERT_FALSE(q.pop(m));
+    TEST_ASSERT_EQUAL_UINT32(STRESS_FRAMES, q.pushedCount());
+    TEST_ASSERT_EQUAL_UINT32(producerDrops, q.droppedCount());
+    TEST_ASSERT_TRUE(q.highWaterMark() <= QUEUE_SIZE);
+    if (producerDrops) TEST_ASSERT_EQUAL_UINT32(QUEUE_SIZE, q.highWaterMark());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_fill_and_overflow);
+    RUN_TEST(test_high_water_tracks_peak);
+    RUN_TEST(test_stress_lossy);
+    RUN_TEST(test_stress_lossless);
+    return UNITY_END();
+}